@@ -117,6 +117,8 @@
         'packages/apib-parser/src/markdown-parser/MarkdownParser.h',
         'packages/apib-parser/src/snowcrash/HTTP.cc',
         'packages/apib-parser/src/snowcrash/HTTP.h',
+        'packages/apib-parser/src/snowcrash/KeywordMatch.cc',
+        'packages/apib-parser/src/snowcrash/KeywordMatch.h',
         'packages/apib-parser/src/snowcrash/MSON.cc',
         'packages/apib-parser/src/snowcrash/MSONOneOfParser.cc',
         'packages/apib-parser/src/snowcrash/MSONSourcemap.cc',
@@ -205,6 +207,7 @@
         'packages/apib-parser/test/snowcrash/test-DataStructureGroupParser.cc',
         'packages/apib-parser/test/snowcrash/test-HeadersParser.cc',
         'packages/apib-parser/test/snowcrash/test-Indentation.cc',
+        'packages/apib-parser/test/snowcrash/test-KeywordMatch.cc',
         'packages/apib-parser/test/snowcrash/test-ModelTable.cc',
         'packages/apib-parser/test/snowcrash/test-MSONMixinParser.cc',
         'packages/apib-parser/test/snowcrash/test-MSONNamedTypeParser.cc',
@@ -248,12 +251,28 @@
       ]
     },
 
+# TEST-LIBAPIB-PARSER-PERF-REGEX
+    {
+      'target_name': 'test-libapib-parser-perf-regex',
+      'type': 'executable',
+      'include_dirs': [
+        'packages/PEGTL/include',
+      ],
+      'sources': [
+        'packages/apib-parser/test/snowcrash/performance/perf-regex.cc'
+      ],
+      'dependencies': [
+        'libapib-parser',
+      ]
+    },
+
 # LIBDRAFTER
     {
       "target_name": "libdrafter",
       'type': '<(libdrafter_type)',
       "conditions" : [
         [ 'libdrafter_type=="shared_library"', { 'defines' : [ 'DRAFTER_BUILD_SHARED' ] }, { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+        [ 'OS!="win"', { 'cflags' : [ '-pthread' ], 'link_settings' : { 'ldflags' : [ '-pthread' ] } } ],
       ],
       'direct_dependent_settings' : {
         'include_dirs': [
@@ -274,8 +293,10 @@
       "sources": [
         "packages/drafter/src/drafter.h",
         "packages/drafter/src/options.h",
+        "packages/drafter/src/stats.h",
         "packages/drafter/src/drafter.cc",
         "packages/drafter/src/options.cc",
+        "packages/drafter/src/stats.cc",
         "packages/drafter/src/stream.h",
         "packages/drafter/src/Version.h",
 
@@ -306,6 +327,8 @@
         "packages/drafter/src/RefractElementFactory.cc",
         "packages/drafter/src/ConversionContext.cc",
         "packages/drafter/src/ConversionContext.h",
+        "packages/drafter/src/GeneratedAssets.cc",
+        "packages/drafter/src/GeneratedAssets.h",
         "packages/drafter/src/ElementInfoUtils.h",
         "packages/drafter/src/ElementComparator.h",
 
@@ -320,6 +343,8 @@
         "packages/drafter/src/utils/so/JsonIo.cc",
         "packages/drafter/src/utils/so/YamlIo.h",
         "packages/drafter/src/utils/so/YamlIo.cc",
+        "packages/drafter/src/utils/so/Writer.h",
+        "packages/drafter/src/utils/so/Writer.cc",
         "packages/drafter/src/utils/log/Trivial.h",
         "packages/drafter/src/utils/log/Trivial.cc",
 
@@ -329,6 +354,8 @@
         "packages/drafter/src/refract/InfoElements.h",
         "packages/drafter/src/refract/InfoElements.cc",
         "packages/drafter/src/refract/InfoElementsUtils.h",
+        "packages/drafter/src/refract/Symbol.h",
+        "packages/drafter/src/refract/Symbol.cc",
         "packages/drafter/src/refract/ElementFwd.h",
         "packages/drafter/src/refract/ElementIfc.h",
         "packages/drafter/src/refract/Element.h",
@@ -358,6 +385,8 @@
         "packages/drafter/src/refract/ElementUtils.cc",
         "packages/drafter/src/refract/ElementSize.h",
         "packages/drafter/src/refract/ElementSize.cc",
+        "packages/drafter/src/refract/StructuralHash.h",
+        "packages/drafter/src/refract/StructuralHash.cc",
         "packages/drafter/src/refract/Cardinal.h",
         "packages/drafter/src/refract/SerializeSo.h",
         "packages/drafter/src/refract/SerializeSo.cc",
@@ -382,6 +411,7 @@
         "packages/drafter/src/refract/dsd/Option.h",
         "packages/drafter/src/refract/dsd/Ref.h",
         "packages/drafter/src/refract/dsd/Select.h",
+        "packages/drafter/src/refract/dsd/SourceMap.h",
         "packages/drafter/src/refract/dsd/String.h",
         "packages/drafter/src/refract/dsd/Traits.h",
 
@@ -397,6 +427,7 @@
         "packages/drafter/src/refract/dsd/Option.cc",
         "packages/drafter/src/refract/dsd/Ref.cc",
         "packages/drafter/src/refract/dsd/Select.cc",
+        "packages/drafter/src/refract/dsd/SourceMap.cc",
         "packages/drafter/src/refract/dsd/String.cc",
 
         "packages/drafter/src/backend/MediaTypeS11n.cc",
@@ -440,12 +471,16 @@
         "packages/drafter/test/utils/test-Utf8.cc",
         "packages/drafter/test/utils/so/test-JsonIo.cc",
         "packages/drafter/test/utils/so/test-YamlIo.cc",
+        "packages/drafter/test/utils/so/test-Writer.cc",
 
         "packages/drafter/test/refract/test-Utils.cc",
         "packages/drafter/test/refract/test-JsonSchema.cc",
         "packages/drafter/test/refract/test-JsonValue.cc",
         "packages/drafter/test/refract/test-ElementSize.cc",
         "packages/drafter/test/refract/test-Cardinal.cc",
+        "packages/drafter/test/refract/test-ExpandVisitor.cc",
+        "packages/drafter/test/refract/test-StructuralHash.cc",
+        "packages/drafter/test/refract/test-Symbol.cc",
 
         "packages/drafter/test/refract/dsd/test-Array.cc",
         "packages/drafter/test/refract/dsd/test-Bool.cc",
@@ -459,6 +494,7 @@
         "packages/drafter/test/refract/dsd/test-Option.cc",
         "packages/drafter/test/refract/dsd/test-Ref.cc",
         "packages/drafter/test/refract/dsd/test-Select.cc",
+        "packages/drafter/test/refract/dsd/test-SourceMap.cc",
         "packages/drafter/test/refract/dsd/test-String.cc",
 
         "packages/drafter/test/refract/dsd/test-Element.cc",
@@ -469,6 +505,9 @@
         "packages/drafter/test/test-ElementComparator.cc",
         "packages/drafter/test/test-VisitorUtils.cc",
         "packages/drafter/test/test-sourceMapToLineColumn.cc",
+        "packages/drafter/test/test-Concurrency.cc",
+        "packages/drafter/test/test-BlueprintGenerator.cc",
+        "packages/drafter/src/BlueprintGenerator.cc",
 
         "packages/drafter/test/backend/test-MediaTypeS11.cc",
       ],
@@ -476,7 +515,55 @@
         "libdrafter",
       ],
       'conditions': [
-         [ 'OS=="win"', { 'defines' : [ 'WIN' ] } ]
+         [ 'OS=="win"', { 'defines' : [ 'WIN' ] } ],
+         [ 'OS!="win"', { 'ldflags' : [ '-pthread' ] } ]
+      ],
+    },
+
+# TEST-LIBDRAFTER-PERF-PARALLEL
+    {
+      'target_name': 'test-libdrafter-perf-parallel',
+      'type': 'executable',
+      'conditions' : [
+        [ 'libdrafter_type=="static_library"', { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+        [ 'OS!="win"', { 'ldflags' : [ '-pthread' ] } ]
+      ],
+      'sources': [
+        'packages/drafter/test/performance/perf-parallel.cc'
+      ],
+      'dependencies': [
+        'libdrafter',
+      ]
+    },
+
+# DRAFTER-BENCH
+    {
+      'target_name': 'drafter-bench',
+      'type': 'executable',
+      'conditions' : [
+        [ 'libdrafter_type=="static_library"', { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+      ],
+      'sources': [
+        'packages/drafter/test/performance/perf-stages.cc',
+        'packages/drafter/src/BlueprintGenerator.cc',
+        'packages/drafter/src/BlueprintGenerator.h',
+      ],
+      'dependencies': [
+        'libdrafter',
+      ]
+    },
+
+# DRAFTER-GENERATE
+    {
+      "target_name": "drafter-generate",
+      "type": "executable",
+      "sources": [
+        "packages/drafter/src/generate.cc",
+        "packages/drafter/src/BlueprintGenerator.cc",
+        "packages/drafter/src/BlueprintGenerator.h",
+      ],
+      "include_dirs": [
+        "packages/cmdline",
       ],
     },
 
@@ -486,6 +573,7 @@
       "type": "executable",
       "conditions" : [
         [ 'libdrafter_type=="static_library"', { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+        [ 'OS!="win"', { 'ldflags' : [ '-pthread' ] } ]
       ],
       "defines": ["LOGGING"],
       "sources": [
@@ -494,6 +582,10 @@
         "packages/drafter/src/config.h",
         "packages/drafter/src/reporting.cc",
         "packages/drafter/src/reporting.h",
+        "packages/drafter/src/input.cc",
+        "packages/drafter/src/input.h",
+        "packages/drafter/src/batch.cc",
+        "packages/drafter/src/batch.h",
       ],
       "include_dirs": [
         "packages/cmdline",
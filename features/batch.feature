@@ -0,0 +1,45 @@
+Feature: Parse a batch of blueprints
+
+  Scenario: Validate blueprint files listed in a file
+
+    Given a file named "list.txt" with:
+    """
+    blueprint.apib
+    invalid_blueprint.apib
+    """
+    When I run `drafter --validate --batch list.txt -j 2`
+    Then the output should contain:
+    """
+    blueprint.apib:
+    OK.
+    invalid_blueprint.apib:
+    OK.
+    warning: (5)  unexpected header block, expected a group, resource or an action definition, e.g. '# Group <name>', '# <resource name> [<URI>]' or '# <HTTP method> <URI>' :24:29
+    """
+    And the output should contain "2 files parsed, 0 failed"
+    And the exit status should be 0
+
+  Scenario: Parse blueprint files listed in a file into Refract JSON next to them
+
+    Given a file named "list.txt" with:
+    """
+    blueprint.apib
+    """
+    When I run `drafter -f json --batch list.txt`
+    Then a file named "blueprint.apib.json" should exist
+    And the exit status should be 0
+
+  Scenario: Report files of a batch which cannot be read
+
+    Given a file named "list.txt" with:
+    """
+    blueprint.apib
+    missing.apib
+    """
+    When I run `drafter --validate --batch list.txt`
+    Then the output should contain:
+    """
+    fatal: unable to open file 'missing.apib'
+    """
+    And the output should contain "2 files parsed, 1 failed"
+    And the exit status should be 1
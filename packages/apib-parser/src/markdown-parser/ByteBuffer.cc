@@ -8,6 +8,9 @@
 
 #include "ByteBuffer.h"
 
+#include <cstdint>
+#include <cstring>
+
 using namespace mdp;
 
 /* Byte lenght of an UTF8 character (based on first byte) */
@@ -85,29 +88,123 @@ static CharactersRange BytesRangeToCharactersRange(const BytesRange& bytesRange,
     return characterRange;
 }
 
+static std::uint64_t LoadWord(const char* s)
+{
+    std::uint64_t word;
+    std::memcpy(&word, s, sizeof(word));
+    return word;
+}
+
+/* Whether any byte of the word is zero */
+static bool HasZeroByte(std::uint64_t word)
+{
+    return ((word - 0x0101010101010101ull) & ~word & 0x8080808080808080ull) != 0;
+}
+
+/* Whether all 8 bytes at s are non-zero ASCII, i.e. 8 single byte characters */
+static bool IsAsciiWord(std::uint64_t word)
+{
+    return !(word & 0x8080808080808080ull) && !HasZeroByte(word);
+}
+
+/* Whether any of the 8 bytes of the word is a newline */
+static bool HasNewline(std::uint64_t word)
+{
+    return HasZeroByte(word ^ 0x0a0a0a0a0a0a0a0aull);
+}
+
 void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer& byteBuffer)
 {
+    BuildCharacterIndex(index, byteBuffer.c_str(), byteBuffer.length());
+}
 
-    const char* source = byteBuffer.c_str();
-    size_t len = byteBuffer.length();
+void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const char* source, size_t len)
+{
+    const size_t Stride = ByteBufferCharacterIndex::Stride;
     size_t pos = 0;
     size_t charPos = 0;
+    size_t checkpoint = 0;
+
+    auto data = std::make_shared<ByteBufferCharacterIndex::Data>();
+    data->source = source;
+    data->size = len;
+    data->characters.reserve(len / Stride + 1);
+    data->leadOffsets.reserve(len / Stride + 1);
+    data->lines.push_back(0);
+
+    while (pos < len && source[pos]) {
+        if (pos + 8 <= len) {
+            std::uint64_t word = LoadWord(source + pos);
+
+            if (IsAsciiWord(word)) {
+                if (checkpoint < pos + 8) {
+                    data->characters.push_back(charPos + checkpoint - pos);
+                    data->leadOffsets.push_back(0);
+                    checkpoint += Stride;
+                }
+
+                if (HasNewline(word)) {
+                    for (size_t i = 0; i < 8; ++i)
+                        if (source[pos + i] == '\n')
+                            data->lines.push_back(charPos + i + 1);
+                }
+
+                pos += 8;
+                charPos += 8;
+                continue;
+            }
+        }
+
+        size_t charLen = UTF8_CHAR_LEN(source[pos]);
 
-    index.resize(byteBuffer.length());
+        for (; checkpoint < pos + charLen && checkpoint < len; checkpoint += Stride) {
+            data->characters.push_back(charPos);
+            data->leadOffsets.push_back(static_cast<unsigned char>(checkpoint - pos));
+        }
+
+        if (source[pos] == '\n')
+            data->lines.push_back(charPos + 1);
 
-    while (source[pos] && pos < len) {
-        int charLen = UTF8_CHAR_LEN(source[pos]);
         pos += charLen;
+        charPos++;
+    }
 
-        while (charLen) {
-            index[pos - charLen] = charPos;
-            charLen--;
-        }
+    data->end = pos < len ? pos : len;
+    index.data_ = std::move(data);
+}
+
+size_t ByteBufferCharacterIndex::operator[](size_t byte) const
+{
+    if (!data_ || byte >= data_->end)
+        return 0;
+
+    const char* source = data_->source;
+    const size_t checkpoint = byte / Stride;
+
+    size_t pos = checkpoint * Stride - data_->leadOffsets[checkpoint];
+    size_t charPos = data_->characters[checkpoint];
+
+    while (pos + 8 <= byte && IsAsciiWord(LoadWord(source + pos))) {
+        pos += 8;
+        charPos += 8;
+    }
+
+    for (;;) {
+        pos += UTF8_CHAR_LEN(source[pos]);
+
+        if (byte < pos)
+            return charPos;
 
         charPos++;
     }
 }
 
+const std::vector<size_t>& ByteBufferCharacterIndex::lines() const
+{
+    static const std::vector<size_t> none;
+    return data_ ? data_->lines : none;
+}
+
 CharactersRangeSet mdp::BytesRangeSetToCharactersRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer)
 {
     CharactersRangeSet characterMap;
@@ -9,6 +9,7 @@
 #ifndef MARKDOWNPARSER_BYTEBUFFER_H
 #define MARKDOWNPARSER_BYTEBUFFER_H
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -70,12 +71,65 @@ namespace mdp
     /** Set of non-continuous character ranges */
     typedef RangeSet<CharactersRange> CharactersRangeSet;
 
-    /** Map byte index into utf-8 chracter index */
-    typedef std::vector<size_t> ByteBufferCharacterIndex;
+    /**
+     *  \brief Map byte index into utf-8 character index
+     *
+     *  Only the character index of every `Stride`-th byte is stored, other
+     *  bytes are resolved by decoding the byte buffer from the preceding
+     *  checkpoint. The indexed byte buffer must outlive the index.
+     *
+     *  The index also records where lines start, so a source is scanned once
+     *  for both. Copies of an index share its data.
+     */
+    class ByteBufferCharacterIndex
+    {
+    public:
+        /** Distance of checkpoints in bytes */
+        static const size_t Stride = 64;
+
+    private:
+        struct Data {
+            const char* source = nullptr;
+            size_t size = 0; // bytes indexed
+            size_t end = 0;  // end of decoded characters, bytes past it map to 0
+
+            std::vector<size_t> characters;         // character at each checkpoint
+            std::vector<unsigned char> leadOffsets; // distance of each checkpoint from its character's first byte
+            std::vector<size_t> lines;              // character index of each line start
+        };
+
+        std::shared_ptr<const Data> data_;
+
+        friend void BuildCharacterIndex(ByteBufferCharacterIndex& index, const char* source, size_t size);
+
+    public:
+        /** \returns Number of bytes indexed */
+        size_t size() const
+        {
+            return data_ ? data_->size : 0;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /** \returns Index of the character the byte at \p byte belongs to */
+        size_t operator[](size_t byte) const;
+
+        /**
+         *  \returns Character indices at which lines start, i.e. 0 followed
+         *           by the index following each newline character
+         */
+        const std::vector<size_t>& lines() const;
+    };
 
     /** Fill character map - cache of characters positions */
     void BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer& byteBuffer);
 
+    /** Fill character map of \p size bytes at \p source, which must outlive the index */
+    void BuildCharacterIndex(ByteBufferCharacterIndex& index, const char* source, size_t size);
+
     /** Convert ranges of bytes to ranges of characters */
     CharactersRangeSet BytesRangeSetToCharactersRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer);
     CharactersRangeSet BytesRangeSetToCharactersRangeSet(
@@ -14,10 +14,11 @@
 
 using namespace mdp;
 
-MarkdownNode::MarkdownNode(MarkdownNodeType type_, MarkdownNode* parent_, const ByteBuffer& text_, const Data& data_)
-    : type(type_), text(text_), data(data_), m_parent(parent_)
+const MarkdownNode::Data MarkdownNode::Unclassified;
+
+MarkdownNode::MarkdownNode(MarkdownNodeType type_, MarkdownNode* parent_, ByteBuffer text_, const Data& data_)
+    : type(type_), text(std::move(text_)), data(data_), classification(Unclassified), m_parent(parent_)
 {
-    m_children.reset(::new MarkdownNodes);
 }
 
 MarkdownNode::MarkdownNode(const MarkdownNode& rhs)
@@ -25,22 +26,62 @@ MarkdownNode::MarkdownNode(const MarkdownNode& rhs)
     this->type = rhs.type;
     this->text = rhs.text;
     this->data = rhs.data;
+    this->classification = rhs.classification;
     this->sourceMap = rhs.sourceMap;
-    this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
+    if (rhs.m_children)
+        this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
     this->m_parent = rhs.m_parent;
 }
 
+MarkdownNode::MarkdownNode(MarkdownNode&& rhs) noexcept
+    : type(rhs.type)
+    , text(std::move(rhs.text))
+    , data(rhs.data)
+    , classification(rhs.classification)
+    , sourceMap(std::move(rhs.sourceMap))
+    , m_parent(rhs.m_parent)
+    , m_children(std::move(rhs.m_children))
+{
+    adoptChildren();
+}
+
 MarkdownNode& MarkdownNode::operator=(const MarkdownNode& rhs)
 {
     this->type = rhs.type;
     this->text = rhs.text;
     this->data = rhs.data;
+    this->classification = rhs.classification;
     this->sourceMap = rhs.sourceMap;
-    this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
+    if (rhs.m_children)
+        this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
+    else
+        this->m_children.reset();
+    this->m_parent = rhs.m_parent;
+    return *this;
+}
+
+MarkdownNode& MarkdownNode::operator=(MarkdownNode&& rhs) noexcept
+{
+    this->type = rhs.type;
+    this->text = std::move(rhs.text);
+    this->data = rhs.data;
+    this->classification = rhs.classification;
+    this->sourceMap = std::move(rhs.sourceMap);
+    this->m_children = std::move(rhs.m_children);
     this->m_parent = rhs.m_parent;
+    adoptChildren();
     return *this;
 }
 
+void MarkdownNode::adoptChildren()
+{
+    if (!m_children)
+        return;
+
+    for (MarkdownNodeIterator it = m_children->begin(); it != m_children->end(); ++it)
+        it->m_parent = this;
+}
+
 MarkdownNode::~MarkdownNode() {}
 
 MarkdownNode& MarkdownNode::parent()
@@ -70,15 +111,17 @@ bool MarkdownNode::hasParent() const
 MarkdownNodes& MarkdownNode::children()
 {
     if (!m_children.get())
-        throw "no children set";
+        m_children.reset(::new MarkdownNodes);
 
     return *m_children;
 }
 
 const MarkdownNodes& MarkdownNode::children() const
 {
+    static const MarkdownNodes NoChildren;
+
     if (!m_children.get())
-        throw "no children set";
+        return NoChildren;
 
     return *m_children;
 }
@@ -141,7 +184,7 @@ void MarkdownNode::printNode(size_t level) const
 
     cerr << std::endl;
 
-    for (MarkdownNodeIterator it = m_children->begin(); it != m_children->end(); ++it) {
+    for (MarkdownNodes::const_iterator it = children().begin(); it != children().end(); ++it) {
         it->printNode(level + 1);
     }
 
@@ -58,6 +58,16 @@ namespace mdp
         /** Additinonal data, if applicable */
         Data data;
 
+        /** Value of %classification of a node not classified yet */
+        static const Data Unclassified = -1;
+
+        /**
+         *  Classification memoized by the client parser, %Unclassified if none
+         *
+         *  Must be derived from the node's type and text only.
+         */
+        mutable Data classification;
+
         /** Source map of the node including any and all children */
         BytesRangeSet sourceMap;
 
@@ -71,22 +81,33 @@ namespace mdp
         /** True if section's parent is specified, false otherwise */
         bool hasParent() const;
 
-        /** Children nodes */
+        /**
+         *  Children nodes
+         *
+         *  Collection is allocated on first non-const access only,
+         *  leaf nodes do not hold any.
+         */
         MarkdownNodes& children();
         const MarkdownNodes& children() const;
 
         /** Constructor */
         MarkdownNode(MarkdownNodeType type_ = UndefinedMarkdownNodeType,
             MarkdownNode* parent_ = NULL,
-            const ByteBuffer& text_ = ByteBuffer(),
+            ByteBuffer text_ = ByteBuffer(),
             const Data& data_ = Data());
 
         /** Copy constructor */
         MarkdownNode(const MarkdownNode& rhs);
 
+        /** Move constructor, children are re-parented to the new node */
+        MarkdownNode(MarkdownNode&& rhs) noexcept;
+
         /** Assignment operator */
         MarkdownNode& operator=(const MarkdownNode& rhs);
 
+        /** Move assignment operator, children are re-parented to this node */
+        MarkdownNode& operator=(MarkdownNode&& rhs) noexcept;
+
         /** Destructor */
         ~MarkdownNode();
 
@@ -98,6 +119,8 @@ namespace mdp
     private:
         MarkdownNode* m_parent;
         std::unique_ptr<MarkdownNodes> m_children;
+
+        void adoptChildren();
     };
 
     /** Markdown AST nodes collection iterator */
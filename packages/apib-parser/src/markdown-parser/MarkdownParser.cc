@@ -100,13 +100,12 @@ void MarkdownParser::renderHeader(struct buf* ob, const struct buf* text, int le
     p->renderHeader(ByteBufferFromSundown(text), level);
 }
 
-void MarkdownParser::renderHeader(const ByteBuffer& text, int level)
+void MarkdownParser::renderHeader(ByteBuffer text, int level)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(HeaderMarkdownNodeType, m_workingNode, text, level);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(HeaderMarkdownNodeType, m_workingNode, std::move(text), level);
 }
 
 void MarkdownParser::beginList(int flags, void* opaque)
@@ -152,8 +151,7 @@ void MarkdownParser::beginListItem(int flags)
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(ListItemMarkdownNodeType, m_workingNode, ByteBuffer(), flags);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(ListItemMarkdownNodeType, m_workingNode, ByteBuffer(), flags);
 
     // Push context
     m_workingNode = &m_workingNode->children().back();
@@ -168,7 +166,7 @@ void MarkdownParser::renderListItem(struct buf* ob, const struct buf* text, int
     p->renderListItem(ByteBufferFromSundown(text), flags);
 }
 
-void MarkdownParser::renderListItem(const ByteBuffer& text, int flags)
+void MarkdownParser::renderListItem(ByteBuffer text, int flags)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
@@ -180,8 +178,7 @@ void MarkdownParser::renderListItem(const ByteBuffer& text, int flags)
     // Instead of storing the text on the list item
     // create the artificial paragraph node to store the text.
     if (m_workingNode->children().empty() || m_workingNode->children().front().type != ParagraphMarkdownNodeType) {
-        MarkdownNode textNode(ParagraphMarkdownNodeType, m_workingNode, text);
-        m_workingNode->children().push_front(textNode);
+        m_workingNode->children().emplace_front(ParagraphMarkdownNodeType, m_workingNode, std::move(text));
     }
 
     m_workingNode->data = flags;
@@ -199,13 +196,12 @@ void MarkdownParser::renderBlockCode(struct buf* ob, const struct buf* text, con
     p->renderBlockCode(ByteBufferFromSundown(text), ByteBufferFromSundown(lang));
 }
 
-void MarkdownParser::renderBlockCode(const ByteBuffer& text, const ByteBuffer& language)
+void MarkdownParser::renderBlockCode(ByteBuffer text, const ByteBuffer& language)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(CodeMarkdownNodeType, m_workingNode, text);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(CodeMarkdownNodeType, m_workingNode, std::move(text));
 }
 
 void MarkdownParser::renderParagraph(struct buf* ob, const struct buf* text, void* opaque)
@@ -217,13 +213,12 @@ void MarkdownParser::renderParagraph(struct buf* ob, const struct buf* text, voi
     p->renderParagraph(ByteBufferFromSundown(text));
 }
 
-void MarkdownParser::renderParagraph(const ByteBuffer& text)
+void MarkdownParser::renderParagraph(ByteBuffer text)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(ParagraphMarkdownNodeType, m_workingNode, text);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(ParagraphMarkdownNodeType, m_workingNode, std::move(text));
 }
 
 void MarkdownParser::renderHorizontalRule(struct buf* ob, void* opaque)
@@ -240,8 +235,7 @@ void MarkdownParser::renderHorizontalRule()
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(HRuleMarkdownNodeType, m_workingNode, ByteBuffer(), MarkdownNode::Data());
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(HRuleMarkdownNodeType, m_workingNode, ByteBuffer(), MarkdownNode::Data());
 }
 
 void MarkdownParser::renderHTML(struct buf* ob, const struct buf* text, void* opaque)
@@ -253,13 +247,12 @@ void MarkdownParser::renderHTML(struct buf* ob, const struct buf* text, void* op
     p->renderHTML(ByteBufferFromSundown(text));
 }
 
-void MarkdownParser::renderHTML(const ByteBuffer& text)
+void MarkdownParser::renderHTML(ByteBuffer text)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(HTMLMarkdownNodeType, m_workingNode, text);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(HTMLMarkdownNodeType, m_workingNode, std::move(text));
 }
 
 void MarkdownParser::beginQuote(void* opaque)
@@ -276,8 +269,7 @@ void MarkdownParser::beginQuote()
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(QuoteMarkdownNodeType, m_workingNode);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(QuoteMarkdownNodeType, m_workingNode);
 
     // Push context
     m_workingNode = &m_workingNode->children().back();
@@ -292,7 +284,7 @@ void MarkdownParser::renderQuote(struct buf* ob, const struct buf* text, void* o
     p->renderQuote(ByteBufferFromSundown(text));
 }
 
-void MarkdownParser::renderQuote(const ByteBuffer& text)
+void MarkdownParser::renderQuote(ByteBuffer text)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
@@ -300,7 +292,7 @@ void MarkdownParser::renderQuote(const ByteBuffer& text)
     if (m_workingNode->type != QuoteMarkdownNodeType)
         throw WORKING_NODE_MISMATCH_ERR;
 
-    m_workingNode->text = text;
+    m_workingNode->text = std::move(text);
 
     // Pop context
     m_workingNode = &m_workingNode->parent();
@@ -61,7 +61,7 @@ namespace mdp
 
         // Header
         static void renderHeader(struct buf* ob, const struct buf* text, int level, void* opaque);
-        void renderHeader(const ByteBuffer& text, int level);
+        void renderHeader(ByteBuffer text, int level);
 
         // List
         static void beginList(int flags, void* opaque);
@@ -75,15 +75,15 @@ namespace mdp
         void beginListItem(int flags);
 
         static void renderListItem(struct buf* ob, const struct buf* text, int flags, void* opaque);
-        void renderListItem(const ByteBuffer& text, int flags);
+        void renderListItem(ByteBuffer text, int flags);
 
         // Code block
         static void renderBlockCode(struct buf* ob, const struct buf* text, const struct buf* lang, void* opaque);
-        void renderBlockCode(const ByteBuffer& text, const ByteBuffer& language);
+        void renderBlockCode(ByteBuffer text, const ByteBuffer& language);
 
         // Paragraph
         static void renderParagraph(struct buf* ob, const struct buf* text, void* opaque);
-        void renderParagraph(const ByteBuffer& text);
+        void renderParagraph(ByteBuffer text);
 
         // Horizontal Rule
         static void renderHorizontalRule(struct buf* ob, void* opaque);
@@ -91,14 +91,14 @@ namespace mdp
 
         // HTML
         static void renderHTML(struct buf* ob, const struct buf* text, void* opaque);
-        void renderHTML(const ByteBuffer& text);
+        void renderHTML(ByteBuffer text);
 
         // Quote
         static void beginQuote(void* opaque);
         void beginQuote();
 
         static void renderQuote(struct buf* ob, const struct buf* text, void* opaque);
-        void renderQuote(const std::string& text);
+        void renderQuote(ByteBuffer text);
 
         // Source maps
         static void blockDidParse(const src_map* map, const uint8_t* txt_data, size_t size, void* opaque);
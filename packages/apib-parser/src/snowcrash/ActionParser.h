@@ -312,9 +312,10 @@ namespace snowcrash
             return UndefinedSectionType;
         }
 
-        static SectionTypes upperSectionTypes()
+        static constexpr SectionTypeSet upperSectionTypes()
         {
-            return { ActionSectionType, ResourceSectionType, ResourceGroupSectionType, DataStructureGroupSectionType };
+            return SectionTypeSet(ActionSectionType) | ResourceSectionType | ResourceGroupSectionType
+                | DataStructureGroupSectionType;
         }
 
         static void finalize(const MarkdownNodeIterator& node, SectionParserData& pd, const ParseResultRef<Action>& out)
@@ -111,13 +111,16 @@ namespace snowcrash
             subject = GetFirstLine(subject, remaining);
             TrimString(subject);
 
-            if (RegexMatch(subject, BodyRegex))
-                return BodyAssetSignature;
+            switch (RecognizeSectionKeyword(subject)) {
+                case BodySectionType:
+                    return BodyAssetSignature;
 
-            if (RegexMatch(subject, SchemaRegex))
-                return SchemaAssetSignature;
+                case SchemaSectionType:
+                    return SchemaAssetSignature;
 
-            return NoAssetSignature;
+                default:
+                    return NoAssetSignature;
+            }
         }
     };
 
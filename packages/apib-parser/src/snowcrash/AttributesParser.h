@@ -100,7 +100,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, AttributesRegex)) {
+                if (RecognizeSectionKeyword(subject) == AttributesSectionType) {
                     return AttributesSectionType;
                 }
             }
@@ -96,7 +96,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, DataStructureGroupRegex)) {
+                if (RecognizeSectionKeyword(subject) == DataStructureGroupSectionType) {
                     return DataStructureGroupSectionType;
                 }
             }
@@ -110,9 +110,9 @@ namespace snowcrash
             return SectionProcessor<mson::NamedType>::sectionType(node);
         }
 
-        static SectionTypes upperSectionTypes()
+        static constexpr SectionTypeSet upperSectionTypes()
         {
-            return { DataStructureGroupSectionType, ResourceGroupSectionType, ResourceSectionType };
+            return SectionTypeSet(DataStructureGroupSectionType) | ResourceGroupSectionType | ResourceSectionType;
         }
 
         /**
@@ -165,7 +165,7 @@ namespace snowcrash
                 signature = GetFirstLine(subject, remainingContent);
                 TrimString(signature);
 
-                if (RegexMatch(signature, HeadersRegex))
+                if (RecognizeSectionKeyword(signature) == HeadersSectionType)
                     return HeadersSectionType;
             }
 
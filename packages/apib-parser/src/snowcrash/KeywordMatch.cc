@@ -0,0 +1,210 @@
+//
+//  KeywordMatch.cc
+//  snowcrash
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "KeywordMatch.h"
+
+using namespace snowcrash;
+
+namespace
+{
+    typedef const char* Cursor;
+
+    // `[[:blank:]]` in POSIX locale
+    inline bool IsBlank(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    inline char ToLower(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+    }
+
+    inline Cursor SkipBlanks(Cursor it, Cursor end)
+    {
+        while (it != end && IsBlank(*it))
+            ++it;
+        return it;
+    }
+
+    // Match keyword given in lowercase, first character is case insensitive
+    // On success moves cursor behind the keyword
+    bool Keyword(Cursor& it, Cursor end, const char* keyword)
+    {
+        Cursor c = it;
+
+        if (c == end || ToLower(*c) != *keyword)
+            return false;
+
+        for (++c, ++keyword; *keyword; ++c, ++keyword) {
+            if (c == end || *c != *keyword)
+                return false;
+        }
+
+        it = c;
+        return true;
+    }
+
+    inline Cursor Optional(Cursor it, Cursor end, char c)
+    {
+        return (it != end && *it == c) ? it + 1 : it;
+    }
+
+    // `[[:blank:]]*$`
+    inline bool BlanksToEnd(Cursor it, Cursor end)
+    {
+        return SkipBlanks(it, end) == end;
+    }
+
+    // `[[:blank:]]+`
+    inline bool SomeBlanks(Cursor& it, Cursor end)
+    {
+        Cursor c = SkipBlanks(it, end);
+        if (c == it)
+            return false;
+
+        it = c;
+        return true;
+    }
+
+    // `[[:blank:]]*(\(.*\))?$`
+    bool AttributesTail(Cursor it, Cursor end)
+    {
+        it = SkipBlanks(it, end);
+
+        if (it == end)
+            return true;
+
+        return (end - it) >= 2 && *it == '(' && *(end - 1) == ')';
+    }
+
+    // `[[:blank:]]*(:.*)?$`
+    bool TypeSectionTail(Cursor it, Cursor end)
+    {
+        it = SkipBlanks(it, end);
+        return it == end || *it == ':';
+    }
+
+    // `[[:blank:]]+([^][()]+)[[:blank:]]*$`
+    bool GroupTail(Cursor it, Cursor end)
+    {
+        if (it == end || !IsBlank(*it))
+            return false;
+
+        if (++it == end)
+            return false;
+
+        for (; it != end; ++it) {
+            if (*it == '[' || *it == ']' || *it == '(' || *it == ')')
+                return false;
+        }
+
+        return true;
+    }
+}
+
+SectionType snowcrash::RecognizeSectionKeyword(const mdp::ByteBuffer& subject)
+{
+    Cursor end = subject.data() + subject.size();
+    Cursor it = SkipBlanks(subject.data(), end);
+
+    if (it == end)
+        return UndefinedSectionType;
+
+    switch (ToLower(*it)) {
+        case 'a':
+            if (Keyword(it, end, "attribute") && AttributesTail(Optional(it, end, 's'), end))
+                return AttributesSectionType;
+            break;
+
+        case 'b':
+            if (Keyword(it, end, "body") && BlanksToEnd(it, end))
+                return BodySectionType;
+            break;
+
+        case 'd':
+            if (Keyword(it, end, "default")) {
+                if (TypeSectionTail(it, end))
+                    return MSONSampleDefaultSectionType;
+            } else if (Keyword(it, end, "data") && SomeBlanks(it, end) && Keyword(it, end, "structure")
+                && BlanksToEnd(Optional(it, end, 's'), end)) {
+                return DataStructureGroupSectionType;
+            }
+            break;
+
+        case 'g':
+            if (Keyword(it, end, "group") && GroupTail(it, end))
+                return ResourceGroupSectionType;
+            break;
+
+        case 'h':
+            if (Keyword(it, end, "header") && BlanksToEnd(Optional(it, end, 's'), end))
+                return HeadersSectionType;
+            break;
+
+        case 'i':
+            if (Keyword(it, end, "include")) {
+                if (it != end && IsBlank(*it))
+                    return MSONMixinSectionType;
+            } else if (Keyword(it, end, "items") && BlanksToEnd(it, end)) {
+                return MSONValueMembersSectionType;
+            }
+            break;
+
+        case 'm':
+            if (Keyword(it, end, "members") && BlanksToEnd(it, end))
+                return MSONValueMembersSectionType;
+            break;
+
+        case 'o':
+            if (Keyword(it, end, "one") && SomeBlanks(it, end) && Keyword(it, end, "of") && BlanksToEnd(it, end))
+                return MSONOneOfSectionType;
+            break;
+
+        case 'p':
+            if (Keyword(it, end, "parameter")) {
+                if (BlanksToEnd(Optional(it, end, 's'), end))
+                    return ParametersSectionType;
+            } else if (Keyword(it, end, "properties") && BlanksToEnd(it, end)) {
+                return MSONPropertyMembersSectionType;
+            }
+            break;
+
+        case 'r':
+            if (Keyword(it, end, "request"))
+                return RequestSectionType;
+
+            if (Keyword(it, end, "response"))
+                return ResponseSectionType;
+
+            if (Keyword(it, end, "relation")) {
+                it = SkipBlanks(it, end);
+                if (it != end && *it == ':')
+                    return RelationSectionType;
+            }
+            break;
+
+        case 's':
+            if (Keyword(it, end, "schema")) {
+                if (BlanksToEnd(it, end))
+                    return SchemaSectionType;
+            } else if (Keyword(it, end, "sample") && TypeSectionTail(it, end)) {
+                return MSONSampleDefaultSectionType;
+            }
+            break;
+
+        case 'v':
+            if (Keyword(it, end, "values") && BlanksToEnd(it, end))
+                return ValuesSectionType;
+            break;
+
+        default:
+            break;
+    }
+
+    return UndefinedSectionType;
+}
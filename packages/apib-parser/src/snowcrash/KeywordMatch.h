@@ -0,0 +1,39 @@
+//
+//  KeywordMatch.h
+//  snowcrash
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_KEYWORDMATCH_H
+#define SNOWCRASH_KEYWORDMATCH_H
+
+#include "ByteBuffer.h"
+#include "Section.h"
+
+namespace snowcrash
+{
+
+    /**
+     *  \brief Recognize keyword-defined section signature
+     *
+     *  Single pass, allocation free replacement of the keyword regexes
+     *  (`HeadersRegex`, `AttributesRegex`, `MSONOneOfRegex` ...). Only the
+     *  first character of a keyword is case insensitive, as in the regexes.
+     *
+     *  Recognized signatures and the type returned:
+     *
+     *  - `Headers`, `Body`, `Schema`, `Values`, `Parameters`, `Attributes (...)`,
+     *    `Data Structures`, `Group <identifier>`, `One Of`, `Include ...`,
+     *    `Default: ...`, `Sample: ...`, `Items`, `Members`, `Properties`,
+     *    `Relation: ...` - type of the section introduced by the keyword
+     *  - `Request ...`, `Response ...` - %RequestSectionType or %ResponseSectionType;
+     *    the regexes of these match a prefix only, so do we
+     *
+     *  \param subject  The signature to be recognized
+     *  \return Type of the section the keyword introduces, %UndefinedSectionType otherwise
+     */
+    SectionType RecognizeSectionKeyword(const mdp::ByteBuffer& subject);
+}
+
+#endif
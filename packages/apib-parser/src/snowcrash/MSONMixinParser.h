@@ -88,7 +88,7 @@ namespace snowcrash
 
                 TrimString(subject);
 
-                if (RegexMatch(subject, MSONMixinRegex)) {
+                if (RecognizeSectionKeyword(subject) == MSONMixinSectionType) {
                     return MSONMixinSectionType;
                 }
             }
@@ -62,7 +62,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, MSONOneOfRegex)) {
+                if (RecognizeSectionKeyword(subject) == MSONOneOfSectionType) {
                     return MSONOneOfSectionType;
                 }
             }
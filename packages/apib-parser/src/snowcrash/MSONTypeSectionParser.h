@@ -182,20 +182,17 @@ namespace snowcrash
             subject = GetFirstLine(subject, remaining);
             TrimString(subject);
 
-            if (RegexMatch(subject, MSONDefaultTypeSectionRegex) || RegexMatch(subject, MSONSampleTypeSectionRegex)) {
+            SectionType type = RecognizeSectionKeyword(subject);
 
-                return MSONSampleDefaultSectionType;
-            }
-
-            if (RegexMatch(subject, MSONValueMembersTypeSectionRegex)) {
-                return MSONValueMembersSectionType;
-            }
+            switch (type) {
+                case MSONSampleDefaultSectionType:
+                case MSONValueMembersSectionType:
+                case MSONPropertyMembersSectionType:
+                    return type;
 
-            if (RegexMatch(subject, MSONPropertyMembersTypeSectionRegex)) {
-                return MSONPropertyMembersSectionType;
+                default:
+                    return UndefinedSectionType;
             }
-
-            return UndefinedSectionType;
         }
 
         static SectionType nestedSectionType(const MarkdownNodeIterator&);
@@ -198,14 +198,13 @@ namespace snowcrash
                         itSubject = GetFirstLine(it->children().front().text, itRemainingContent);
                         TrimString(itSubject);
 
-                        if (RegexMatch(itSubject, MSONDefaultTypeSectionRegex)
-                            || RegexMatch(itSubject, MSONSampleTypeSectionRegex)
-                            || RegexMatch(itSubject, MSONValueMembersTypeSectionRegex)) {
+                        SectionType itType = RecognizeSectionKeyword(itSubject);
 
+                        if (itType == MSONSampleDefaultSectionType || itType == MSONValueMembersSectionType) {
                             return MSONParameterSectionType;
                         }
 
-                        if (RegexMatch(itSubject, ParameterValuesRegex)) {
+                        if (itType == ValuesSectionType) {
                             return ParameterSectionType;
                         }
                     }
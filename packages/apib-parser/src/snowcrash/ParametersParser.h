@@ -123,7 +123,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, ParametersRegex)) {
+                if (RecognizeSectionKeyword(subject) == ParametersSectionType) {
                     return ParametersSectionType;
                 }
             }
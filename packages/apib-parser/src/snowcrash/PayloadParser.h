@@ -351,13 +351,19 @@ namespace snowcrash
             signature = GetFirstLine(subject, remainingContent);
             TrimString(signature);
 
-            if (RegexMatch(signature, RequestRegex))
-                return RequestPayloadSignature;
+            switch (RecognizeSectionKeyword(signature)) {
+                case RequestSectionType:
+                    return RequestPayloadSignature;
+
+                case ResponseSectionType:
+                    return ResponsePayloadSignature;
 
-            if (RegexMatch(signature, ResponseRegex))
-                return ResponsePayloadSignature;
+                default:
+                    break;
+            }
 
-            if (RegexMatch(signature, ModelRegex))
+            // Model signature may be named, look for the keyword before evaluating regex
+            if (signature.find("odel") != mdp::ByteBuffer::npos && RegexMatch(signature, ModelRegex))
                 return ModelPayloadSignature;
 
             return NoPayloadSignature;
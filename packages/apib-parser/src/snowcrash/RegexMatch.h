@@ -15,6 +15,12 @@
 namespace snowcrash
 {
 
+    // Compile given expressions into the process-wide regex cache
+    //
+    // All matching functions below compile an expression only once and reuse
+    // the compiled pattern afterwards. Precompiling just moves this cost ahead.
+    void RegexPrecompile(const char* const* expressions, size_t count);
+
     // Perform snowcrash-specific regex evaluation
     // returns true if target string matches given expression, false otherwise
     bool RegexMatch(const std::string& target, const std::string& expression);
@@ -75,7 +75,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, RelationRegex)) {
+                if (RecognizeSectionKeyword(subject) == RelationSectionType) {
                     return RelationSectionType;
                 }
             }
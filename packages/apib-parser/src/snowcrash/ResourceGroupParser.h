@@ -198,7 +198,7 @@ namespace snowcrash
                 mdp::ByteBuffer subject = node->text;
                 TrimString(subject);
 
-                if (RegexMatch(subject, GroupHeaderRegex)) {
+                if (RecognizeSectionKeyword(subject) == ResourceGroupSectionType) {
                     return ResourceGroupSectionType;
                 }
             }
@@ -213,9 +213,9 @@ namespace snowcrash
             return SectionProcessor<Resource>::sectionType(node);
         }
 
-        static SectionTypes upperSectionTypes()
+        static constexpr SectionTypeSet upperSectionTypes()
         {
-            return { ResourceGroupSectionType, DataStructureGroupSectionType };
+            return SectionTypeSet(ResourceGroupSectionType) | DataStructureGroupSectionType;
         }
 
         static bool isDescriptionNode(const MarkdownNodeIterator& node, SectionType sectionType)
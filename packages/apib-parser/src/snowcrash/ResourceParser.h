@@ -263,9 +263,9 @@ namespace snowcrash
             return UndefinedSectionType;
         }
 
-        static SectionTypes upperSectionTypes()
+        static constexpr SectionTypeSet upperSectionTypes()
         {
-            return { ResourceGroupSectionType, ResourceSectionType, DataStructureGroupSectionType };
+            return SectionTypeSet(ResourceGroupSectionType) | ResourceSectionType | DataStructureGroupSectionType;
         }
 
         static void finalize(
@@ -55,6 +55,48 @@ namespace snowcrash
         MSONSectionType                 /// < MSON Property Member or Value Member
     };
 
+    /**
+     *  \brief Set of %SectionTypes
+     *
+     *  Bitset over the %SectionType enumeration, usable in constant
+     *  expressions: `SectionTypeSet(ResourceSectionType) | ActionSectionType`.
+     */
+    class SectionTypeSet
+    {
+        typedef unsigned long long Bits;
+
+        Bits m_bits;
+
+        constexpr explicit SectionTypeSet(Bits bits) : m_bits(bits) {}
+
+    public:
+        /** Constructs the empty set */
+        constexpr SectionTypeSet() : m_bits(0) {}
+
+        /** Constructs the set of one %SectionType */
+        constexpr SectionTypeSet(SectionType type) : m_bits(Bits(1) << type) {}
+
+        /** \return The set with the %SectionType added */
+        constexpr SectionTypeSet operator|(SectionType type) const
+        {
+            return SectionTypeSet(m_bits | (Bits(1) << type));
+        }
+
+        /** \return True if the %SectionType is in the set */
+        constexpr bool contains(SectionType type) const
+        {
+            return (m_bits >> type) & Bits(1);
+        }
+
+        /** \return True if the set has no %SectionTypes */
+        constexpr bool empty() const
+        {
+            return m_bits == 0;
+        }
+    };
+
+    static_assert(MSONSectionType < 64, "SectionTypeSet holds up to 64 section types");
+
     /** \return Human readable name for given %SectionType */
     extern std::string SectionName(const SectionType& section);
 }
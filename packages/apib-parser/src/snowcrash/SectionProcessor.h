@@ -12,6 +12,7 @@
 #include "SectionParserData.h"
 #include "SourceAnnotation.h"
 #include "Signature.h"
+#include "KeywordMatch.h"
 
 // Use the following macro whenever a section doesn't have description
 #define NO_SECTION_DESCRIPTION(T)                                                                                      \
@@ -35,8 +36,6 @@ namespace snowcrash
     using mdp::MarkdownNodeIterator;
     using mdp::MarkdownNodes;
 
-    typedef Collection<SectionType>::type SectionTypes;
-
     /**
      *  Layout of the section being parsed
      */
@@ -250,9 +249,7 @@ namespace snowcrash
                 return true;
             }
 
-            SectionTypes upperTypes = SectionProcessor<T>::upperSectionTypes();
-
-            if (std::find(upperTypes.begin(), upperTypes.end(), keywordSectionType) != upperTypes.end()) {
+            if (SectionProcessor<T>::upperSectionTypes().contains(keywordSectionType)) {
                 // Node is a keyword defined section defined in an upper level section
                 return false;
             }
@@ -271,9 +268,8 @@ namespace snowcrash
         {
 
             SectionType keywordSectionType = SectionKeywordSignature(node);
-            SectionTypes upperTypes = SectionProcessor<T>::upperSectionTypes();
 
-            if (std::find(upperTypes.begin(), upperTypes.end(), keywordSectionType) == upperTypes.end()) {
+            if (!SectionProcessor<T>::upperSectionTypes().contains(keywordSectionType)) {
                 // Node is not a section that is upper level
                 return true;
             }
@@ -282,9 +278,9 @@ namespace snowcrash
         }
 
         /** \return All upper level sections of the section */
-        static SectionTypes upperSectionTypes()
+        static constexpr SectionTypeSet upperSectionTypes()
         {
-            return SectionTypes();
+            return SectionTypeSet();
         }
 
         /** \return %SectionType of the node */
@@ -25,7 +25,7 @@ using namespace snowcrash;
         return type;                                                                                                   \
     }
 
-SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator& node)
+static SectionType ClassifySectionKeyword(const mdp::MarkdownNodeIterator& node)
 {
     // Note: Every-keyword defined section should be listed here...
     SectionType type = UndefinedSectionType;
@@ -55,19 +55,29 @@ SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator&
     return type;
 }
 
+SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator& node)
+{
+    // The signature depends on the node only, yet it is queried by every
+    // parser level the node is visited from; recognize it just once
+    if (node->classification == mdp::MarkdownNode::Unclassified)
+        node->classification = ClassifySectionKeyword(node);
+
+    return static_cast<SectionType>(node->classification);
+}
+
 SectionType snowcrash::RecognizeCodeBlockFirstLine(const mdp::ByteBuffer& subject)
 {
-    SectionType type = UndefinedSectionType;
+    SectionType type = RecognizeSectionKeyword(subject);
 
-    if (RegexMatch(subject, HeadersRegex)) {
-        return HeadersSectionType;
-    } else if (RegexMatch(subject, BodyRegex)) {
-        return BodySectionType;
-    } else if (RegexMatch(subject, SchemaRegex)) {
-        return SchemaSectionType;
-    }
+    switch (type) {
+        case HeadersSectionType:
+        case BodySectionType:
+        case SchemaSectionType:
+            return type;
 
-    return type;
+        default:
+            return UndefinedSectionType;
+    }
 }
 
 #undef TYPECHECK
@@ -78,7 +78,7 @@ namespace snowcrash
                 mdp::ByteBuffer subject = node->children().front().text;
                 TrimString(subject);
 
-                if (RegexMatch(subject, ValuesRegex)) {
+                if (RecognizeSectionKeyword(subject) == ValuesSectionType) {
                     return ValuesSectionType;
                 }
             }
@@ -7,39 +7,124 @@
 //
 
 #include <regex.h>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "../RegexMatch.h"
 
-// FIXME: Migrate to C++11.
-// Naive implementation of regex matching using POSIX regex
+namespace
+{
+    struct CompiledRegex {
+        regex_t regex;
+        bool valid;
+
+        explicit CompiledRegex(const std::string& expression)
+        {
+            valid = ::regcomp(&regex, expression.c_str(), REG_EXTENDED) == 0;
+        }
+
+        ~CompiledRegex()
+        {
+            if (valid)
+                ::regfree(&regex);
+        }
+
+        CompiledRegex(const CompiledRegex&) = delete;
+        CompiledRegex& operator=(const CompiledRegex&) = delete;
+    };
+
+    typedef std::unordered_map<std::string, std::shared_ptr<const CompiledRegex> > CompiledRegexes;
+
+    const regex_t* pattern(const CompiledRegex& compiled)
+    {
+        return compiled.valid ? &compiled.regex : nullptr;
+    }
+
+    //
+    // Process-wide cache of compiled expressions
+    //
+    // Precompiled expressions are looked up without locking in an immutable
+    // map published once precompiled; other expressions are compiled on
+    // demand into a mutex guarded map.
+    //
+    // Entries are never evicted, so a returned pointer stays valid for the
+    // lifetime of the process. `regexec` does not modify the compiled pattern
+    // and may be called concurrently on the same `regex_t`.
+    //
+    class RegexCache
+    {
+        std::atomic<const CompiledRegexes*> precompiled_;
+
+        std::mutex mutex_;
+        CompiledRegexes cache_;
+        std::vector<std::unique_ptr<const CompiledRegexes> > published_; // kept alive for concurrent readers
+
+        RegexCache() : precompiled_(nullptr) {}
+
+    public:
+        static RegexCache& instance()
+        {
+            static RegexCache cache;
+            return cache;
+        }
+
+        void precompile(const char* const* expressions, size_t count)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            const CompiledRegexes* current = precompiled_.load(std::memory_order_relaxed);
+            std::unique_ptr<CompiledRegexes> next(current ? new CompiledRegexes(*current) : new CompiledRegexes);
+
+            for (size_t i = 0; i < count; ++i) {
+                if (next->find(expressions[i]) == next->end())
+                    next->emplace(expressions[i], std::make_shared<const CompiledRegex>(expressions[i]));
+            }
+
+            precompiled_.store(next.get(), std::memory_order_release);
+            published_.push_back(std::move(next));
+        }
+
+        const regex_t* get(const std::string& expression)
+        {
+            if (const CompiledRegexes* precompiled = precompiled_.load(std::memory_order_acquire)) {
+                auto it = precompiled->find(expression);
+                if (it != precompiled->end())
+                    return pattern(*it->second);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto it = cache_.find(expression);
+            if (it == cache_.end())
+                it = cache_.emplace(expression, std::make_shared<const CompiledRegex>(expression)).first;
+
+            // invalid expressions are cached too, so they are not recompiled on every call
+            return pattern(*it->second);
+        }
+    };
+}
+
+void snowcrash::RegexPrecompile(const char* const* expressions, size_t count)
+{
+    RegexCache::instance().precompile(expressions, count);
+}
+
 bool snowcrash::RegexMatch(const std::string& target, const std::string& expression)
 {
     if (target.empty() || expression.empty())
         return false;
 
-    regex_t regex;
-    int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED | REG_NOSUB);
-    if (reti) {
+    const regex_t* regex = RegexCache::instance().get(expression);
+    if (!regex) {
         // Unable to compile regex
         return false;
     }
 
     // Execute regular expression
-    reti = ::regexec(&regex, target.c_str(), 0, NULL, 0);
-    if (!reti) {
-        ::regfree(&regex);
-        return true;
-    } else if (reti == REG_NOMATCH) {
-        ::regfree(&regex);
-        return false;
-    } else {
-        char msgbuf[1024];
-        regerror(reti, &regex, msgbuf, sizeof(msgbuf));
-        ::regfree(&regex);
-        return false;
-    }
-
-    return false;
+    return ::regexec(regex, target.c_str(), 0, NULL, 0) == 0;
 }
 
 std::string snowcrash::RegexCaptureFirst(const std::string& target, const std::string& expression)
@@ -60,32 +145,24 @@ bool snowcrash::RegexCapture(
     captureGroups.clear();
 
     try {
-        regex_t regex;
-        int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED);
-        if (reti)
+        const regex_t* regex = RegexCache::instance().get(expression);
+        if (!regex)
             return false;
 
-        regmatch_t* pmatch = ::new regmatch_t[groupSize];
-        ::memset(pmatch, 0, sizeof(regmatch_t) * groupSize);
-
-        reti = ::regexec(&regex, target.c_str(), groupSize, pmatch, 0);
-        if (!reti) {
-            ::regfree(&regex);
+        std::vector<regmatch_t> pmatch(groupSize);
 
-            for (size_t i = 0; i < groupSize; ++i) {
-                if (pmatch[i].rm_so == -1 || pmatch[i].rm_eo == -1)
-                    captureGroups.push_back(std::string());
-                else
-                    captureGroups.push_back(std::string(target, pmatch[i].rm_so, pmatch[i].rm_eo - pmatch[i].rm_so));
-            }
-
-            delete[] pmatch;
-            return true;
-        } else {
-            ::regfree(&regex);
-            delete[] pmatch;
+        if (::regexec(regex, target.c_str(), groupSize, pmatch.data(), 0))
             return false;
+
+        captureGroups.reserve(groupSize);
+        for (size_t i = 0; i < groupSize; ++i) {
+            if (pmatch[i].rm_so == -1 || pmatch[i].rm_eo == -1)
+                captureGroups.push_back(std::string());
+            else
+                captureGroups.push_back(std::string(target, pmatch[i].rm_so, pmatch[i].rm_eo - pmatch[i].rm_so));
         }
+
+        return true;
     } catch (...) {
     }
 
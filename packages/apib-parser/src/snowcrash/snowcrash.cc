@@ -8,11 +8,62 @@
 
 #include "snowcrash.h"
 #include "BlueprintParser.h"
+#include "MSONMixinParser.h"
+#include "MSONOneOfParser.h"
 
 const int snowcrash::SourceAnnotation::OK = 0;
 
 using namespace snowcrash;
 
+/**
+ *  Keyword & signature expressions evaluated for (almost) every markdown node
+ */
+static const char* const PrecompiledRegexes[] = { ActionHeaderRegex,
+    NamedActionHeaderRegex,
+    NamedActionNonAbsoluteURIRegex,
+    BodyRegex,
+    SchemaRegex,
+    AttributesRegex,
+    DataStructureGroupRegex,
+    HeadersRegex,
+    MSONMixinRegex,
+    MSONReservedCharsRegex,
+    MSONOneOfRegex,
+    MSONDefaultTypeSectionRegex,
+    MSONSampleTypeSectionRegex,
+    MSONValueMembersTypeSectionRegex,
+    MSONPropertyMembersTypeSectionRegex,
+    ModelReferenceRegex,
+    ParameterRequiredRegex,
+    ParameterOptionalRegex,
+    AdditionalTraitsExampleRegex,
+    AdditionalTraitsUseRegex,
+    ParameterValuesRegex,
+    EnumRegex,
+    ParametersRegex,
+    RequestRegex,
+    ResponseRegex,
+    ModelRegex,
+    RelationRegex,
+    RelationIdentifierRegex,
+    GroupHeaderRegex,
+    ResourceHeaderRegex,
+    NamedResourceHeaderRegex,
+    NamedEndpointHeaderRegex,
+    ValuesRegex,
+    mdp::MarkdownLinkRegex };
+
+/**
+ *  \brief  Fill the regex cache at startup, so parsing never waits on `regcomp`
+ */
+static bool PrecompileRegexes()
+{
+    RegexPrecompile(PrecompiledRegexes, sizeof(PrecompiledRegexes) / sizeof(PrecompiledRegexes[0]));
+    return true;
+}
+
+static const bool RegexesPrecompiled = PrecompileRegexes();
+
 /**
  *  \brief  Check source for unsupported character \t & \r
  *  \return True if passed (not found), false otherwise
@@ -50,6 +101,18 @@ static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
 
 int snowcrash::parse(
     const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
+{
+    mdp::ByteBufferCharacterIndex sourceIndex;
+    mdp::BuildCharacterIndex(sourceIndex, source);
+
+    return parse(source, sourceIndex, options, out);
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+    const mdp::ByteBufferCharacterIndex& sourceIndex,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    ParseObserver* observer)
 {
     try {
 
@@ -66,9 +129,12 @@ int snowcrash::parse(
         mdp::MarkdownNode markdownAST;
         markdownParser.parse(source, markdownAST);
 
+        if (observer)
+            observer->markdownParsed(markdownAST);
+
         // Build SectionParserData
         SectionParserData pd(options, source, out.node);
-        mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source);
+        pd.sourceCharacterIndex = sourceIndex;
 
         // Parse Blueprint
         BlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
@@ -29,6 +29,22 @@
 namespace snowcrash
 {
 
+    /**
+     *  \brief Receiver of the progress of parsing, e.g. to measure its phases
+     */
+    class ParseObserver
+    {
+    public:
+        virtual ~ParseObserver() {}
+
+        /**
+         *  \brief Markdown has been parsed, parsing of API Blueprint sections starts
+         *
+         *  \param markdownAST  The Markdown AST of the source.
+         */
+        virtual void markdownParsed(const mdp::MarkdownNode& markdownAST) = 0;
+    };
+
     /**
      *  \brief Parse the source data into a blueprint abstract source tree (AST).
      *
@@ -38,6 +54,22 @@ namespace snowcrash
      *  \return Error status code. Zero represents success, non-zero a failure.
      */
     int parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out);
+
+    /**
+     *  \brief Parse the source data into a blueprint abstract source tree (AST).
+     *
+     *  \param source       A textual source data to be parsed.
+     *  \param sourceIndex  Character index built from \p source, shared with the caller.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing result into.
+     *  \param observer     Optional receiver of the progress of parsing.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+        const mdp::ByteBufferCharacterIndex& sourceIndex,
+        BlueprintParserOptions options,
+        const ParseResultRef<Blueprint>& out,
+        ParseObserver* observer = nullptr);
 }
 
 #endif
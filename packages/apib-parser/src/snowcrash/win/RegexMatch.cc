@@ -7,7 +7,12 @@
 //
 
 #include <regex>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "../RegexMatch.h"
 
 using namespace std;
@@ -19,14 +24,95 @@ using namespace std::tr1;
 // A C++09 implementation
 //
 
+namespace
+{
+    // NULL for invalid expressions, which are cached too, so they are not recompiled on every call
+    typedef unordered_map<string, shared_ptr<const regex> > CompiledRegexes;
+
+    shared_ptr<const regex> compile(const string& expression)
+    {
+        try {
+            return make_shared<const regex>(expression, regex_constants::extended);
+        } catch (const regex_error&) {
+            return nullptr;
+        }
+    }
+
+    //
+    // Process-wide cache of compiled expressions
+    //
+    // Precompiled expressions are looked up without locking in an immutable
+    // map published once precompiled; other expressions are compiled on
+    // demand into a mutex guarded map.
+    //
+    // Entries are never evicted. Matching against a `const std::regex` is
+    // safe to do concurrently.
+    //
+    class RegexCache
+    {
+        atomic<const CompiledRegexes*> precompiled_;
+
+        mutex mutex_;
+        CompiledRegexes cache_;
+        vector<unique_ptr<const CompiledRegexes> > published_; // kept alive for concurrent readers
+
+        RegexCache() : precompiled_(nullptr) {}
+
+    public:
+        static RegexCache& instance()
+        {
+            static RegexCache cache;
+            return cache;
+        }
+
+        void precompile(const char* const* expressions, size_t count)
+        {
+            lock_guard<mutex> lock(mutex_);
+
+            const CompiledRegexes* current = precompiled_.load(memory_order_relaxed);
+            unique_ptr<CompiledRegexes> next(current ? new CompiledRegexes(*current) : new CompiledRegexes);
+
+            for (size_t i = 0; i < count; ++i) {
+                if (next->find(expressions[i]) == next->end())
+                    next->emplace(expressions[i], compile(expressions[i]));
+            }
+
+            precompiled_.store(next.get(), memory_order_release);
+            published_.push_back(std::move(next));
+        }
+
+        const regex* get(const string& expression)
+        {
+            if (const CompiledRegexes* precompiled = precompiled_.load(memory_order_acquire)) {
+                auto it = precompiled->find(expression);
+                if (it != precompiled->end())
+                    return it->second.get();
+            }
+
+            lock_guard<mutex> lock(mutex_);
+
+            auto it = cache_.find(expression);
+            if (it == cache_.end())
+                it = cache_.emplace(expression, compile(expression)).first;
+
+            return it->second.get();
+        }
+    };
+}
+
+void snowcrash::RegexPrecompile(const char* const* expressions, size_t count)
+{
+    RegexCache::instance().precompile(expressions, count);
+}
+
 bool snowcrash::RegexMatch(const string& target, const string& expression)
 {
     if (target.empty() || expression.empty())
         return false;
 
     try {
-        regex pattern(expression, regex_constants::extended);
-        return regex_search(target, pattern);
+        const regex* pattern = RegexCache::instance().get(expression);
+        return pattern && regex_search(target, *pattern);
     } catch (const regex_error&) {
     } catch (...) {
     }
@@ -53,9 +139,12 @@ bool snowcrash::RegexCapture(
 
     try {
 
-        regex pattern(expression, regex_constants::extended);
+        const regex* pattern = RegexCache::instance().get(expression);
+        if (!pattern)
+            return false;
+
         match_results<string::const_iterator> result;
-        if (!regex_search(target, result, pattern))
+        if (!regex_search(target, result, *pattern))
             return false;
 
         for (match_results<string::const_iterator>::const_iterator it = result.begin(); it != result.end(); ++it) {
@@ -119,6 +119,21 @@ TEST_CASE("Character index")
     REQUIRE(index[10] == 4);
 }
 
+TEST_CASE("Character index records line starts", "[bytebuffer][sourcemap]")
+{
+    // $¢€𐍈 on separate lines, followed by a line longer than a word
+    ByteBuffer src = "\x24\n\xc2\xa2\n\xe2\x82\xac\n\xf0\x90\x8d\x88\n0123456789abcdef\nx";
+    ByteBufferCharacterIndex index;
+
+    mdp::BuildCharacterIndex(index, src);
+
+    const std::vector<size_t> expected = { 0, 2, 4, 6, 8, 25 };
+    REQUIRE(index.lines() == expected);
+
+    ByteBufferCharacterIndex copy = index;
+    REQUIRE(&copy.lines() == &index.lines());
+}
+
 TEST_CASE("Byte buffer and Index should provide equal information", "[bytebuffer][sourcemap]")
 {
     MarkdownParser parser;
@@ -180,3 +195,36 @@ TEST_CASE("Byte buffer and Index should return equal char ranges", "[bytebuffer]
     REQUIRE(charMap[4].location == indexMap[4].location);
     REQUIRE(charMap[4].length == indexMap[4].length);
 }
+
+TEST_CASE("Index spanning many checkpoints should return equal char ranges", "[bytebuffer][sourcemap]")
+{
+    ByteBuffer src;
+    for (int i = 0; i < 100; ++i) {
+        src += "# Resource \xc2\xa2 ";
+        src += std::string(i % 17, 'x');
+        src += "\xe2\x82\xac\xf0\x90\x8d\x88\n";
+    }
+
+    ByteBufferCharacterIndex index;
+    mdp::BuildCharacterIndex(index, src);
+
+    REQUIRE(index.size() == src.length());
+
+    // a range per line
+    BytesRangeSet byteMap;
+    for (size_t location = 0; location < src.length();) {
+        size_t end = src.find('\n', location) + 1;
+        byteMap.push_back(Range(location, end - location));
+        location = end;
+    }
+
+    CharactersRangeSet charMap = BytesRangeSetToCharactersRangeSet(byteMap, src);
+    CharactersRangeSet indexMap = BytesRangeSetToCharactersRangeSet(byteMap, index);
+
+    REQUIRE(charMap.size() == indexMap.size());
+
+    for (size_t i = 0; i < charMap.size(); ++i) {
+        REQUIRE(charMap[i].location == indexMap[i].location);
+        REQUIRE(charMap[i].length == indexMap[i].length);
+    }
+}
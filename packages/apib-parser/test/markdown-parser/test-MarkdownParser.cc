@@ -753,3 +753,43 @@ TEST_CASE("Empty quota in listitem", "[parser]")
     REQUIRE(list.children()[1].children()[0].children()[0].sourceMap[0].location == 25);
     REQUIRE(list.children()[1].children()[0].children()[0].sourceMap[0].length == 3);
 }
+
+TEST_CASE("Leaf node has no children", "[node]")
+{
+    const MarkdownNode node(ParagraphMarkdownNodeType, NULL, "Lorem");
+
+    REQUIRE(node.text == "Lorem");
+    REQUIRE(node.children().empty());
+}
+
+TEST_CASE("Moved node adopts children", "[node]")
+{
+    MarkdownNode root(RootMarkdownNodeType);
+    root.children().emplace_back(ParagraphMarkdownNodeType, &root, "Lorem");
+    root.children().emplace_back(ParagraphMarkdownNodeType, &root, "Ipsum");
+
+    MarkdownNode moved(std::move(root));
+
+    REQUIRE(moved.children().size() == 2);
+    REQUIRE(&moved.children().front().parent() == &moved);
+    REQUIRE(&moved.children().back().parent() == &moved);
+    REQUIRE(moved.children().back().text == "Ipsum");
+
+    MarkdownNode assigned;
+    assigned = std::move(moved);
+
+    REQUIRE(assigned.children().size() == 2);
+    REQUIRE(&assigned.children().front().parent() == &assigned);
+}
+
+TEST_CASE("Copied node keeps its children", "[node]")
+{
+    MarkdownNode root(RootMarkdownNodeType);
+    root.children().emplace_back(ParagraphMarkdownNodeType, &root, "Lorem");
+
+    MarkdownNode copy(root);
+
+    REQUIRE(copy.children().size() == 1);
+    REQUIRE(copy.children().front().text == "Lorem");
+    REQUIRE(root.children().size() == 1);
+}
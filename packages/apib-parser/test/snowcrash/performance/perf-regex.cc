@@ -0,0 +1,169 @@
+//
+//  perf-regex.cc
+//  snowcrash
+//
+//  Per-node cost of keyword regex evaluation with and without
+//  the compiled-expression cache
+//
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include "snowcrash.h"
+#include "BlueprintParser.h"
+#include "MSONMixinParser.h"
+#include "MSONOneOfParser.h"
+#include "MarkdownParser.h"
+
+#if defined(_MSC_VER)
+#include <regex>
+#else
+#include <regex.h>
+#endif
+
+static const int TestRunCount = 100;
+
+/**
+ *  Expressions evaluated while classifying a markdown node
+ */
+static const char* const KeywordRegexes[] = { snowcrash::ActionHeaderRegex,
+    snowcrash::NamedActionHeaderRegex,
+    snowcrash::BodyRegex,
+    snowcrash::SchemaRegex,
+    snowcrash::AttributesRegex,
+    snowcrash::DataStructureGroupRegex,
+    snowcrash::HeadersRegex,
+    snowcrash::MSONMixinRegex,
+    snowcrash::MSONOneOfRegex,
+    snowcrash::MSONDefaultTypeSectionRegex,
+    snowcrash::MSONSampleTypeSectionRegex,
+    snowcrash::MSONValueMembersTypeSectionRegex,
+    snowcrash::MSONPropertyMembersTypeSectionRegex,
+    snowcrash::ModelReferenceRegex,
+    snowcrash::ParametersRegex,
+    snowcrash::RequestRegex,
+    snowcrash::ResponseRegex,
+    snowcrash::ModelRegex,
+    snowcrash::RelationRegex,
+    snowcrash::GroupHeaderRegex,
+    snowcrash::ResourceHeaderRegex,
+    snowcrash::NamedResourceHeaderRegex,
+    snowcrash::ValuesRegex };
+
+static const size_t KeywordRegexCount = sizeof(KeywordRegexes) / sizeof(KeywordRegexes[0]);
+
+/**
+ *  \brief  Regex evaluation compiling the expression on every call
+ *          (the behaviour before the compiled-expression cache)
+ */
+static bool UncachedRegexMatch(const std::string& target, const std::string& expression)
+{
+    if (target.empty() || expression.empty())
+        return false;
+
+#if defined(_MSC_VER)
+    try {
+        std::regex pattern(expression, std::regex_constants::extended);
+        return std::regex_search(target, pattern);
+    } catch (...) {
+    }
+
+    return false;
+#else
+    regex_t regex;
+    if (::regcomp(&regex, expression.c_str(), REG_EXTENDED | REG_NOSUB))
+        return false;
+
+    bool result = ::regexec(&regex, target.c_str(), 0, NULL, 0) == 0;
+    ::regfree(&regex);
+    return result;
+#endif
+}
+
+static void CollectNodeTexts(const mdp::MarkdownNode& node, std::vector<std::string>& texts)
+{
+    if (!node.text.empty()) {
+        std::string remaining;
+        texts.push_back(snowcrash::GetFirstLine(node.text, remaining));
+    }
+
+    for (const auto& child : node.children())
+        CollectNodeTexts(child, texts);
+}
+
+/**
+ *  \brief  Match every node against every keyword expression @TestRunCount -times
+ *  \return Mean time spent on single node (us)
+ */
+template <typename Matcher>
+static double testfunc(const std::vector<std::string>& texts, Matcher match, size_t& matches)
+{
+    matches = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < TestRunCount; ++i) {
+        for (const auto& text : texts) {
+            for (size_t r = 0; r < KeywordRegexCount; ++r) {
+                if (match(text, KeywordRegexes[r]))
+                    ++matches;
+            }
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double total = std::chrono::duration<double, std::micro>(end - start).count();
+
+    return total / (static_cast<double>(TestRunCount) * texts.size());
+}
+
+int main(int argc, const char* argv[])
+{
+    if (argc != 2) {
+        std::cerr << "one input file expected\n";
+        exit(EXIT_FAILURE);
+    }
+
+    // Read fixture file
+    std::ifstream inputFileStream;
+    std::string inputFileName = argv[1];
+    inputFileStream.open(inputFileName.c_str());
+    if (!inputFileStream.is_open()) {
+        std::cerr << "fatal: unable to open input file '" << inputFileName << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::stringstream inputStream;
+    inputStream << inputFileStream.rdbuf();
+    inputFileStream.close();
+
+    mdp::MarkdownParser markdownParser;
+    mdp::MarkdownNode markdownAST;
+    markdownParser.parse(inputStream.str(), markdownAST);
+
+    std::vector<std::string> texts;
+    CollectNodeTexts(markdownAST, texts);
+
+    if (texts.empty()) {
+        std::cerr << "fatal: no markdown nodes in '" << inputFileName << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::cout << "running regex performance test...\n";
+    std::cout << "matching " << texts.size() << " nodes against " << KeywordRegexCount << " expressions "
+              << TestRunCount << "-times:\n";
+
+    size_t uncachedMatches = 0;
+    double uncached = testfunc(texts, UncachedRegexMatch, uncachedMatches);
+    std::cout << "uncached: " << uncached << "us per node\n";
+
+    size_t cachedMatches = 0;
+    double cached = testfunc(texts, snowcrash::RegexMatch, cachedMatches);
+    std::cout << "cached:   " << cached << "us per node (" << (cached > 0 ? uncached / cached : 0) << "x)\n";
+
+    if (uncachedMatches != cachedMatches) {
+        std::cerr << "fatal: results differ (" << uncachedMatches << " vs. " << cachedMatches << ")\n";
+        exit(EXIT_FAILURE);
+    }
+}
@@ -0,0 +1,75 @@
+//
+//  test-KeywordMatch.cc
+//  snowcrash
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+#include "KeywordMatch.h"
+
+using namespace snowcrash;
+
+TEST_CASE("keywordmatch/simple", "Plain keywords")
+{
+    REQUIRE(RecognizeSectionKeyword("Headers") == HeadersSectionType);
+    REQUIRE(RecognizeSectionKeyword("header") == HeadersSectionType);
+    REQUIRE(RecognizeSectionKeyword("  Body ") == BodySectionType);
+    REQUIRE(RecognizeSectionKeyword("Schema") == SchemaSectionType);
+    REQUIRE(RecognizeSectionKeyword("Values") == ValuesSectionType);
+    REQUIRE(RecognizeSectionKeyword("Parameters") == ParametersSectionType);
+    REQUIRE(RecognizeSectionKeyword("Parameter") == ParametersSectionType);
+    REQUIRE(RecognizeSectionKeyword("Items") == MSONValueMembersSectionType);
+    REQUIRE(RecognizeSectionKeyword("members") == MSONValueMembersSectionType);
+    REQUIRE(RecognizeSectionKeyword("Properties") == MSONPropertyMembersSectionType);
+}
+
+TEST_CASE("keywordmatch/case", "Only the first character is case insensitive")
+{
+    REQUIRE(RecognizeSectionKeyword("HEADERS") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("bODY") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("one Of") == MSONOneOfSectionType);
+    REQUIRE(RecognizeSectionKeyword("One OF") == UndefinedSectionType);
+}
+
+TEST_CASE("keywordmatch/multiword", "Keywords made of more words")
+{
+    REQUIRE(RecognizeSectionKeyword("Data Structures") == DataStructureGroupSectionType);
+    REQUIRE(RecognizeSectionKeyword("data\tstructure") == DataStructureGroupSectionType);
+    REQUIRE(RecognizeSectionKeyword("DataStructures") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("One Of") == MSONOneOfSectionType);
+    REQUIRE(RecognizeSectionKeyword("OneOf") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("One Of Them") == UndefinedSectionType);
+}
+
+TEST_CASE("keywordmatch/tail", "Keywords followed by content")
+{
+    REQUIRE(RecognizeSectionKeyword("Attributes (object)") == AttributesSectionType);
+    REQUIRE(RecognizeSectionKeyword("Attributes (") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("Attributes object") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("Default: 42") == MSONSampleDefaultSectionType);
+    REQUIRE(RecognizeSectionKeyword("Sample") == MSONSampleDefaultSectionType);
+    REQUIRE(RecognizeSectionKeyword("Sample 42") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("Include User") == MSONMixinSectionType);
+    REQUIRE(RecognizeSectionKeyword("Include") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("Relation: self") == RelationSectionType);
+    REQUIRE(RecognizeSectionKeyword("Relation self") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("Group Notes") == ResourceGroupSectionType);
+    REQUIRE(RecognizeSectionKeyword("Group [Notes]") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("Group") == UndefinedSectionType);
+}
+
+TEST_CASE("keywordmatch/payload", "Request and response keywords match prefix")
+{
+    REQUIRE(RecognizeSectionKeyword("Request") == RequestSectionType);
+    REQUIRE(RecognizeSectionKeyword("Request Create (application/json)") == RequestSectionType);
+    REQUIRE(RecognizeSectionKeyword("Response 200") == ResponseSectionType);
+    REQUIRE(RecognizeSectionKeyword("Model") == UndefinedSectionType);
+}
+
+TEST_CASE("keywordmatch/empty", "No keyword")
+{
+    REQUIRE(RecognizeSectionKeyword("") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("   ") == UndefinedSectionType);
+    REQUIRE(RecognizeSectionKeyword("Lorem ipsum") == UndefinedSectionType);
+}
@@ -9,6 +9,11 @@
 #include <catch2/catch.hpp>
 #include "RegexMatch.h"
 
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace snowcrash;
 
 TEST_CASE("regexmatch/simple", "Simple regex test")
@@ -35,3 +40,77 @@ TEST_CASE("regexmatch/request-payload", "Match request payload test")
                 "^[Rr]equest([[:space:]]+([A-Za-z0-9_]|[[:space:]])*)?([[:space:]]\\([^\\)]*\\))?$")
         == true);
 }
+
+TEST_CASE("regexmatch/cached", "Repeated evaluation of a cached expression")
+{
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(RegexMatch("Headers", "^[[:blank:]]*[Hh]eaders?[[:blank:]]*$") == true);
+        REQUIRE(RegexMatch("Body", "^[[:blank:]]*[Hh]eaders?[[:blank:]]*$") == false);
+    }
+}
+
+TEST_CASE("regexmatch/invalid", "Invalid expression never matches")
+{
+    REQUIRE(RegexMatch("abc", "(abc") == false);
+    REQUIRE(RegexMatch("abc", "(abc") == false);
+
+    CaptureGroups groups;
+    REQUIRE(RegexCapture("abc", "(abc", groups) == false);
+    REQUIRE(groups.empty());
+}
+
+TEST_CASE("regexcapture/cached", "Shared expression captures with different group sizes")
+{
+    const char* const expression = "^([a-z]+)-([0-9]+)$";
+
+    CaptureGroups groups;
+    REQUIRE(RegexMatch("abc-123", expression) == true);
+    REQUIRE(RegexCapture("abc-123", expression, groups, 3) == true);
+    REQUIRE(groups.size() == 3);
+    REQUIRE(groups[1] == "abc");
+    REQUIRE(groups[2] == "123");
+
+    REQUIRE(RegexCapture("xyz-9", expression, groups) == true);
+    REQUIRE(groups.size() == 8);
+    REQUIRE(groups[1] == "xyz");
+    REQUIRE(groups[2] == "9");
+    REQUIRE(groups[3].empty());
+}
+
+TEST_CASE("regexmatch/precompile", "Precompiled expressions are matched")
+{
+    const char* const expressions[] = { "^[Vv]alues$", "^[Bb]ody$" };
+    RegexPrecompile(expressions, 2);
+
+    REQUIRE(RegexMatch("Values", expressions[0]) == true);
+    REQUIRE(RegexMatch("body", expressions[1]) == true);
+    REQUIRE(RegexMatch("Schema", expressions[1]) == false);
+}
+
+TEST_CASE("regexmatch/concurrent", "Precompiled and on demand expressions are matched concurrently")
+{
+    const char* const precompiled[] = { "^[Hh]eaders?$", "(invalid" };
+    RegexPrecompile(precompiled, 2);
+
+    std::atomic<int> mismatches{ 0 };
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t]() {
+            // every thread compiles expressions of its own next to the shared ones
+            const std::string own = "^thread-" + std::to_string(t) + "-[0-9]+$";
+
+            for (int i = 0; i < 100; ++i) {
+                if (!RegexMatch("Headers", precompiled[0]) || RegexMatch("(invalid", precompiled[1])
+                    || !RegexMatch("thread-" + std::to_string(t) + "-" + std::to_string(i), own)
+                    || RegexCaptureFirst("abc-" + std::to_string(i), "^[a-z]+-([0-9]+)$") != std::to_string(i))
+                    ++mismatches;
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(mismatches == 0);
+}
@@ -536,3 +536,36 @@ TEST_CASE("Identifier with an underscore", "[signature]")
     REQUIRE(signature.content.empty());
     REQUIRE(signature.remainingContent.empty());
 }
+
+TEST_CASE("Section keyword signature is memoized on the node", "[signature]")
+{
+    mdp::MarkdownNodes nodes;
+    nodes.push_back(mdp::MarkdownNode(mdp::HeaderMarkdownNodeType, NULL, "Group Gists"));
+    nodes.push_back(mdp::MarkdownNode(mdp::ParagraphMarkdownNodeType, NULL, "Lorem Ipsum"));
+
+    REQUIRE(nodes[0].classification == mdp::MarkdownNode::Unclassified);
+    REQUIRE(nodes[1].classification == mdp::MarkdownNode::Unclassified);
+
+    REQUIRE(SectionKeywordSignature(nodes.begin()) == ResourceGroupSectionType);
+    REQUIRE(SectionKeywordSignature(nodes.begin() + 1) == UndefinedSectionType);
+
+    REQUIRE(nodes[0].classification == ResourceGroupSectionType);
+    REQUIRE(nodes[1].classification == UndefinedSectionType);
+
+    mdp::MarkdownNode copy = nodes[0];
+    REQUIRE(copy.classification == ResourceGroupSectionType);
+    REQUIRE(SectionKeywordSignature(nodes.begin()) == ResourceGroupSectionType);
+}
+
+TEST_CASE("Section type sets", "[signature]")
+{
+    constexpr SectionTypeSet upperTypes = SectionTypeSet(ResourceGroupSectionType) | ResourceSectionType;
+    static_assert(upperTypes.contains(ResourceSectionType), "");
+
+    REQUIRE(SectionTypeSet().empty());
+    REQUIRE(upperTypes.contains(ResourceGroupSectionType));
+    REQUIRE(upperTypes.contains(ResourceSectionType));
+    REQUIRE_FALSE(upperTypes.contains(ActionSectionType));
+    REQUIRE_FALSE(upperTypes.contains(UndefinedSectionType));
+    REQUIRE_FALSE(upperTypes.empty());
+}
@@ -0,0 +1,198 @@
+//
+//  BlueprintGenerator.cc
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "BlueprintGenerator.h"
+
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+
+using namespace drafter;
+
+namespace
+{
+    /**
+     *  \brief Pseudo-random numbers of equal sequence on all platforms (xorshift32)
+     */
+    class Random
+    {
+        std::uint32_t state_;
+
+    public:
+        explicit Random(std::uint32_t seed) : state_(seed ? seed : 1) {}
+
+        /** \return Next number of [0, bound) */
+        std::size_t operator()(std::size_t bound)
+        {
+            state_ ^= state_ << 13;
+            state_ ^= state_ >> 17;
+            state_ ^= state_ << 5;
+            return bound ? state_ % bound : 0;
+        }
+    };
+
+    const char* const Methods[] = { "GET", "POST", "PUT", "PATCH", "DELETE" };
+    const char* const ActionNames[] = { "Retrieve", "Create", "Replace", "Update", "Delete" };
+
+    const std::size_t MaxActions = sizeof(Methods) / sizeof(Methods[0]);
+
+    std::string TypeName(std::size_t i)
+    {
+        return "Type" + std::to_string(i);
+    }
+
+    std::string TraitName(std::size_t i, std::size_t m)
+    {
+        return "Trait" + std::to_string(i) + "x" + std::to_string(m);
+    }
+
+    /**
+     *  Named types form chains of `inheritanceDepth` ancestors rooted in an object;
+     *  properties refer to types of preceding chains only, so there are no cycles.
+     *  Each mixin is a trait of its own, so no member is included twice.
+     */
+    void WriteNamedType(std::ostream& out, std::size_t i, const BlueprintShape& shape, Random& random)
+    {
+        const std::size_t level = i % (shape.inheritanceDepth + 1);
+        const std::size_t chainStart = i - level;
+
+        for (std::size_t m = 0; m < shape.mixins; ++m) {
+            out << "## " << TraitName(i, m) << " (object)\n\n";
+            out << "+ trait" << i << "x" << m << ": " << m << " (number)\n";
+            out << "+ label" << i << "x" << m << ": Trait " << m << " of " << TypeName(i) << "\n\n";
+        }
+
+        out << "## " << TypeName(i) << " (" << (level ? TypeName(i - 1) : std::string("object")) << ")\n\n";
+        out << "Data structure " << i << " of the synthetic API.\n\n";
+
+        for (std::size_t m = 0; m < shape.mixins; ++m)
+            out << "+ Include " << TraitName(i, m) << "\n";
+
+        for (std::size_t p = 0; p < shape.properties; ++p) {
+            const std::string suffix = std::to_string(i) + "p" + std::to_string(p);
+
+            switch (random(chainStart ? 7 : 5)) {
+                case 0:
+                    out << "+ name" << suffix << ": Lorem ipsum " << p << " (string, required) - Name " << p << "\n";
+                    break;
+                case 1:
+                    out << "+ count" << suffix << ": " << random(1000) << " (number)\n";
+                    break;
+                case 2:
+                    out << "+ enabled" << suffix << ": true (boolean, optional)\n";
+                    break;
+                case 3:
+                    out << "+ tags" << suffix << " (array[string])\n";
+                    out << "    + lorem\n";
+                    out << "    + ipsum\n";
+                    break;
+                case 4:
+                    out << "+ kind" << suffix << " (enum[string])\n";
+                    out << "    + first\n";
+                    out << "    + second\n";
+                    break;
+                case 5:
+                    out << "+ item" << suffix << " (" << TypeName(random(chainStart)) << ")\n";
+                    break;
+                default:
+                    out << "+ items" << suffix << " (array[" << TypeName(random(chainStart)) << "])\n";
+                    break;
+            }
+        }
+
+        if (shape.oneOfFanOut) {
+            out << "+ One Of\n";
+            for (std::size_t o = 0; o < shape.oneOfFanOut; ++o)
+                out << "    + option" << i << "o" << o << ": " << o << " (string)\n";
+        }
+
+        out << "\n";
+    }
+
+    void WriteResourceGroup(std::ostream& out, std::size_t g, const BlueprintShape& shape, Random& random)
+    {
+        const std::size_t actions = std::min(shape.actions, MaxActions);
+
+        out << "# Group Group" << g << "\n\n";
+        out << "Resource group " << g << " of the synthetic API.\n\n";
+
+        for (std::size_t r = 0; r < shape.resources; ++r) {
+            const std::string suffix = std::to_string(g) + "r" + std::to_string(r);
+
+            out << "## Resource " << suffix << " [/groups" << g << "/resources" << r << "/{id}]\n\n";
+            out << "+ Parameters\n";
+            out << "    + id: 42 (number) - Identifier of the item\n\n";
+
+            if (shape.namedTypes)
+                out << "+ Attributes (" << TypeName(random(shape.namedTypes)) << ")\n\n";
+
+            for (std::size_t a = 0; a < actions; ++a) {
+                out << "### " << ActionNames[a] << " " << suffix << " [" << Methods[a] << "]\n\n";
+
+                const bool hasBody = a != 0 && a != MaxActions - 1;
+
+                if (hasBody && shape.namedTypes) {
+                    out << "+ Request (application/json)\n\n";
+                    out << "    + Attributes (" << TypeName(random(shape.namedTypes)) << ")\n\n";
+                }
+
+                if (a == MaxActions - 1) {
+                    out << "+ Response 204\n\n";
+                } else if (shape.namedTypes) {
+                    out << "+ Response 200 (application/json)\n\n";
+                    out << "    + Attributes (" << TypeName(random(shape.namedTypes)) << ")\n\n";
+                } else {
+                    out << "+ Response 200 (application/json)\n\n";
+                    out << "        {\"id\": 42}\n\n";
+                }
+            }
+        }
+    }
+}
+
+std::size_t drafter::GenerateBlueprint(std::ostream& out, const BlueprintShape& shape)
+{
+    Random random(shape.seed);
+    std::size_t written = 0;
+
+    auto flush = [&out, &written](std::ostringstream& section) {
+        const std::string data = section.str();
+        out.write(data.data(), data.size());
+        written += data.size();
+        section.str(std::string());
+    };
+
+    std::ostringstream section;
+
+    section << "FORMAT: 1A\n\n";
+    section << "# Synthetic API\n\n";
+    section << "API Blueprint generated by drafter-generate.\n\n";
+    flush(section);
+
+    if (shape.namedTypes) {
+        section << "# Data Structures\n\n";
+
+        for (std::size_t i = 0; i < shape.namedTypes; ++i) {
+            WriteNamedType(section, i, shape, random);
+            flush(section);
+        }
+    }
+
+    for (std::size_t g = 0; g < shape.resourceGroups || (shape.size && written < shape.size); ++g) {
+        WriteResourceGroup(section, g, shape, random);
+        flush(section);
+    }
+
+    return written;
+}
+
+std::string drafter::GenerateBlueprint(const BlueprintShape& shape)
+{
+    std::ostringstream out;
+    GenerateBlueprint(out, shape);
+    return out.str();
+}
@@ -0,0 +1,67 @@
+//
+//  BlueprintGenerator.h
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_BLUEPRINTGENERATOR_H
+#define DRAFTER_BLUEPRINTGENERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace drafter
+{
+
+    /**
+     *  \brief Shape of a synthetic API Blueprint
+     */
+    struct BlueprintShape {
+        /** Number of resource groups */
+        std::size_t resourceGroups = 4;
+
+        /** Number of resources in each group */
+        std::size_t resources = 8;
+
+        /** Number of actions of each resource, up to one per HTTP method (5) */
+        std::size_t actions = 3;
+
+        /** Number of MSON named types in the Data Structures section */
+        std::size_t namedTypes = 32;
+
+        /** Number of ancestors of the most derived named types */
+        std::size_t inheritanceDepth = 3;
+
+        /** Number of options of the `One Of` section of each named type, 0 for none */
+        std::size_t oneOfFanOut = 2;
+
+        /** Number of mixins included in each named type */
+        std::size_t mixins = 1;
+
+        /** Number of properties of each named type */
+        std::size_t properties = 8;
+
+        /** Size of the output (bytes) to be reached by adding resource groups, 0 for no minimum */
+        std::size_t size = 0;
+
+        /** Seed of the pseudo-random choices; equal shapes generate equal blueprints */
+        std::uint32_t seed = 1;
+    };
+
+    /**
+     *  \brief Write a valid API Blueprint of given shape
+     *
+     *  The output is deterministic, it depends on the shape only.
+     *
+     *  \return Number of bytes written
+     */
+    std::size_t GenerateBlueprint(std::ostream& out, const BlueprintShape& shape);
+
+    /** \return A valid API Blueprint of given shape */
+    std::string GenerateBlueprint(const BlueprintShape& shape);
+}
+
+#endif // #ifndef DRAFTER_BLUEPRINTGENERATOR_H
@@ -12,11 +12,30 @@
 
 using namespace drafter;
 
-ConversionContext::ConversionContext(const char* src, const drafter_parse_options* opts, bool expandMson) noexcept
-    : newline_indices_(GetLinesEndIndex(src)),
+namespace
+{
+    thread_local ConversionContext::WarningsBuffer* warningsBuffer = nullptr;
+}
+
+ConversionContext::WarningsBuffer::WarningsBuffer(const ConversionContext& context) noexcept
+    : context_(context), previous_(warningsBuffer), warnings_{}
+{
+    warningsBuffer = this;
+}
+
+ConversionContext::WarningsBuffer::~WarningsBuffer()
+{
+    warningsBuffer = previous_;
+}
+
+ConversionContext::ConversionContext(
+    const mdp::ByteBufferCharacterIndex& sourceIndex, const drafter_parse_options* opts, bool expandMson) noexcept
+    : source_index_(sourceIndex),
       expand_mson_{ expandMson },
       options_{ opts },
       registry_{},
+      expanded_types_{},
+      generated_assets_{},
       warnings_{}
 {
 }
@@ -31,9 +50,19 @@ const refract::Registry& ConversionContext::typeRegistry() const noexcept
     return registry_;
 }
 
+refract::ExpandedTypes& ConversionContext::expandedTypes() noexcept
+{
+    return expanded_types_;
+}
+
+GeneratedAssets& ConversionContext::generatedAssets() noexcept
+{
+    return generated_assets_;
+}
+
 const NewLinesIndex& ConversionContext::newlineIndices() const noexcept
 {
-    return newline_indices_;
+    return source_index_.lines();
 }
 
 bool ConversionContext::expandMson() const noexcept
@@ -43,6 +72,11 @@ bool ConversionContext::expandMson() const noexcept
 
 void ConversionContext::warn(const snowcrash::Warning& warning)
 {
+    if (warningsBuffer && &warningsBuffer->context_ == this) {
+        warningsBuffer->warnings_.push_back(warning);
+        return;
+    }
+
     for (auto& item : warnings_) {
         bool equalSourceMap = true;
 
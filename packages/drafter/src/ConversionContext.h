@@ -11,6 +11,8 @@
 #include <boost/container/vector.hpp>
 
 #include "refract/Registry.h"
+#include "refract/ExpandVisitor.h"
+#include "GeneratedAssets.h"
 #include "SourceMapUtils.h"
 #include "options.h"
 
@@ -27,16 +29,18 @@ namespace drafter
         using Warnings = boost::container::vector<snowcrash::SourceAnnotation>;
 
     private:
-        const NewLinesIndex newline_indices_;
+        const mdp::ByteBufferCharacterIndex source_index_;
         const bool expand_mson_;
         const drafter_parse_options* const options_;
 
         refract::Registry registry_;
+        refract::ExpandedTypes expanded_types_;
+        GeneratedAssets generated_assets_;
         Warnings warnings_;
 
     public:
         explicit ConversionContext( //
-            const char*,
+            const mdp::ByteBufferCharacterIndex& sourceIndex,
             const drafter_parse_options* opts = nullptr,
             bool expandMson = false // TODO avoid, only used in unit tests
             ) noexcept;
@@ -48,10 +52,46 @@ namespace drafter
         refract::Registry& typeRegistry() noexcept;
         const refract::Registry& typeRegistry() const noexcept;
 
+        // named types expanded from typeRegistry(), shared by all expansions of this conversion
+        refract::ExpandedTypes& expandedTypes() noexcept;
+
+        // bodies and schemas generated from expanded data structures, shared by all payloads of this conversion
+        GeneratedAssets& generatedAssets() noexcept;
+
         const Warnings& warnings() const noexcept;
         void warn(const snowcrash::Warning& warning);
 
         const drafter_parse_options* options() const noexcept;
+
+        class WarningsBuffer;
+    };
+
+    /**
+     *  \brief Buffers warnings given to a ConversionContext by the calling thread while in scope
+     *
+     *  Lets concurrent conversions collect their warnings apart, to be merged
+     *  into the context later in a deterministic order.
+     */
+    class ConversionContext::WarningsBuffer
+    {
+        const ConversionContext& context_;
+        WarningsBuffer* previous_;
+        Warnings warnings_;
+
+        friend class ConversionContext;
+
+    public:
+        explicit WarningsBuffer(const ConversionContext& context) noexcept;
+        ~WarningsBuffer();
+
+        WarningsBuffer(const WarningsBuffer&) = delete;
+        WarningsBuffer& operator=(const WarningsBuffer&) = delete;
+
+        /** \return Warnings buffered, not de-duplicated yet */
+        const Warnings& warnings() const noexcept
+        {
+            return warnings_;
+        }
     };
 }
 #endif
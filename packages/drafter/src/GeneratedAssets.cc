@@ -0,0 +1,107 @@
+//
+//  GeneratedAssets.cc
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "GeneratedAssets.h"
+
+#include "refract/JsonSchema.h"
+#include "refract/JsonValue.h"
+#include "refract/StructuralHash.h"
+#include "utils/so/JsonIo.h"
+#include "stats.h"
+
+#include <cassert>
+#include <sstream>
+
+using namespace drafter;
+
+namespace
+{
+    class DeferredAsset final : public refract::dsd::String::Deferred
+    {
+        using Generator = const std::string& (GeneratedAssets::Entry::*)();
+
+        std::shared_ptr<GeneratedAssets::Entry> entry_;
+        Generator generate_;
+
+    public:
+        DeferredAsset(std::shared_ptr<GeneratedAssets::Entry> entry, Generator generate) noexcept
+            : entry_(std::move(entry)), generate_(generate)
+        {
+            assert(entry_);
+        }
+
+        const std::string& get() const override
+        {
+            return ((*entry_).*generate_)();
+        }
+    };
+}
+
+GeneratedAssets::Entry::Entry(std::unique_ptr<refract::IElement> dataStructure) noexcept
+    : dataStructure_(std::move(dataStructure)), body_(), schema_(), bodyGenerated_(), schemaGenerated_()
+{
+    assert(dataStructure_);
+}
+
+const std::string& GeneratedAssets::Entry::body()
+{
+    std::call_once(bodyGenerated_, [this]() {
+        StageScope stage(DRAFTER_STAGE_BODY, false);
+        stage.addElements(*dataStructure_);
+        stage.start();
+
+        std::stringstream ss{};
+        utils::so::serialize_json(ss, refract::generateJsonValue(*dataStructure_));
+        body_ = ss.str();
+    });
+
+    return body_;
+}
+
+const std::string& GeneratedAssets::Entry::schema()
+{
+    std::call_once(schemaGenerated_, [this]() {
+        StageScope stage(DRAFTER_STAGE_SCHEMA, false);
+        stage.addElements(*dataStructure_);
+        stage.start();
+
+        std::stringstream ss{};
+        utils::so::serialize_json(ss, refract::schema::generateJsonSchema(*dataStructure_));
+        schema_ = ss.str();
+    });
+
+    return schema_;
+}
+
+std::shared_ptr<const refract::dsd::String::Deferred> GeneratedAssets::deferredBody(std::shared_ptr<Entry> entry)
+{
+    return std::make_shared<DeferredAsset>(std::move(entry), &Entry::body);
+}
+
+std::shared_ptr<const refract::dsd::String::Deferred> GeneratedAssets::deferredSchema(std::shared_ptr<Entry> entry)
+{
+    return std::make_shared<DeferredAsset>(std::move(entry), &Entry::schema);
+}
+
+std::shared_ptr<GeneratedAssets::Entry> GeneratedAssets::find(std::unique_ptr<refract::IElement> expanded)
+{
+    assert(expanded);
+
+    const std::size_t hash = refract::structuralHash(*expanded);
+    const auto range = entries_.equal_range(hash);
+
+    for (auto it = range.first; it != range.second; ++it)
+        if (refract::structurallyEqual(it->second->dataStructure(), *expanded))
+            return it->second;
+
+    return entries_.emplace(hash, std::make_shared<Entry>(std::move(expanded)))->second;
+}
+
+void GeneratedAssets::clear() noexcept
+{
+    entries_.clear();
+}
@@ -0,0 +1,86 @@
+//
+//  GeneratedAssets.h
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_GENERATEDASSETS_H
+#define DRAFTER_GENERATEDASSETS_H
+
+#include "refract/ElementIfc.h"
+#include "refract/dsd/String.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace drafter
+{
+    /**
+     *  \brief Message bodies and JSON Schemas generated from expanded data structures
+     *
+     *  Data structures equal but for their source maps share one entry, so
+     *  assets of data structures used by many payloads are generated once.
+     *  Entries are shared with deferred assets and so outlive clear().
+     */
+    class GeneratedAssets
+    {
+    public:
+        /**
+         *  \brief Expanded data structure and the assets generated from it so far
+         *
+         *  Assets are generated once even if queried by several threads at once.
+         */
+        class Entry
+        {
+            std::unique_ptr<refract::IElement> dataStructure_;
+            std::string body_;
+            std::string schema_;
+            std::once_flag bodyGenerated_;
+            std::once_flag schemaGenerated_;
+
+        public:
+            explicit Entry(std::unique_ptr<refract::IElement> dataStructure) noexcept;
+
+            Entry(const Entry&) = delete;
+            Entry& operator=(const Entry&) = delete;
+
+            const refract::IElement& dataStructure() const noexcept
+            {
+                return *dataStructure_;
+            }
+
+            /** \return JSON value of the data structure, generated on first call */
+            const std::string& body();
+
+            /** \return JSON Schema of the data structure, generated on first call */
+            const std::string& schema();
+        };
+
+        /** \return JSON value of the data structure of an entry, generated when first queried */
+        static std::shared_ptr<const refract::dsd::String::Deferred> deferredBody(std::shared_ptr<Entry> entry);
+
+        /** \return JSON Schema of the data structure of an entry, generated when first queried */
+        static std::shared_ptr<const refract::dsd::String::Deferred> deferredSchema(std::shared_ptr<Entry> entry);
+
+    private:
+        std::unordered_multimap<std::size_t, std::shared_ptr<Entry> > entries_;
+
+    public:
+        /**
+         *  \brief Find the entry of a data structure equal to given one, add one if there is none
+         *
+         *  \param expanded  data structure, kept by the entry if added
+         *
+         *  \return Entry
+         */
+        std::shared_ptr<Entry> find(std::unique_ptr<refract::IElement> expanded);
+
+        void clear() noexcept;
+    };
+}
+
+#endif
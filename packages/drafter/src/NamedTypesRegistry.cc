@@ -1,9 +1,15 @@
 #include "NamedTypesRegistry.h"
 
 #include <algorithm>
-#include <map>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <queue>
 #include <set>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "Blueprint.h"
 #include "ConversionContext.h"
@@ -11,6 +17,7 @@
 #include "NodeInfo.h"
 #include "RefractDataStructure.h"
 #include "RefractElementFactory.h"
+#include "options.h"
 #include "refract/Exception.h"
 #include "refract/Registry.h"
 #include "refract/InfoElements.h"
@@ -91,7 +98,6 @@ namespace
 {
 
     using Members = std::set<std::string>;
-    using MembersMap = std::map<std::string, Members>;
 
     Members collectMembers(const mson::Elements& elements);
     Members collectMembers(const mson::TypeSections& ts);
@@ -153,9 +159,17 @@ namespace
         }
     }
 
-    void collectElementMember(const mson::Element::OneOfSection& el, Members& result) {}
+    void collectElementMember(const mson::Element::OneOfSection& el, Members& result)
+    {
+        Members sub = collectMembers(*el);
+        result.insert(sub.begin(), sub.end());
+    }
 
-    void collectElementMember(const mson::Element::GroupSection& el, Members& result) {}
+    void collectElementMember(const mson::Element::GroupSection& el, Members& result)
+    {
+        Members sub = collectMembers(*el);
+        result.insert(sub.begin(), sub.end());
+    }
 
     void collectElementMember(const mson::Element::Empty& el, Members& result) {}
 
@@ -207,191 +221,363 @@ namespace
         return collectMembers(ds->sections);
     }
 
-    Members collectMembers(const std::string& id, const MembersMap& members, Members& resolved)
+    /**
+     *  \brief Named types as a graph of their dependencies
+     *
+     *  Types are identified by their index into DataStructures. A type depends
+     *  on its parent and on the types it refers to directly (members, mixins,
+     *  nested types); deeper dependencies follow from the order of the graph.
+     */
+    class DependencyGraph
     {
-        Members collected;
+    public:
+        using Id = std::size_t;
 
-        if (resolved.find(id) != resolved.end()) {
-            return collected;
-        }
+    private:
+        static const Id None = static_cast<Id>(-1);
 
-        resolved.insert(id);
+        const DataStructures& types_;
 
-        MembersMap::const_iterator member = members.find(id);
-        if (member == members.end()) {
-            return collected;
-        }
+        std::vector<Id> parents_;                  // parent of each type, None if none
+        std::vector<std::vector<Id> > dependents_; // types depending on each type
+        std::vector<std::size_t> dependencies_;    // number of dependencies of each type
+        bool unique_;                              // whether no two named types share a name
 
-        for (Members::const_iterator i = member->second.begin(); i != member->second.end(); ++i) {
-            Members sub = collectMembers(*i, members, resolved);
-            collected.insert(*i);
-            collected.insert(sub.begin(), sub.end());
+        static const std::string& parent(const snowcrash::DataStructure* ds)
+        {
+            return ds->typeDefinition.typeSpecification.name.symbol.literal;
         }
 
-        return collected;
-    }
+        void depend(Id type, Id dependency)
+        {
+            if (type == dependency)
+                return;
 
-    struct DependencyTypeInfo {
+            dependents_[dependency].push_back(type);
+            ++dependencies_[type];
+        }
 
-        typedef std::map<std::string, std::string> InheritanceMap;
-        InheritanceMap childToParent;
+    public:
+        explicit DependencyGraph(const DataStructures& types)
+            : types_(types),
+              parents_(types.size(), None),
+              dependents_(types.size()),
+              dependencies_(types.size(), 0),
+              unique_(true)
+        {
+            // later definitions of a name take precedence; types of no name are never registered,
+            // nor referenced, e.g. by the empty names of nested anonymous types among members
+            std::unordered_map<std::string, Id> ids;
+            ids.reserve(types.size());
 
-        MembersMap objectToMembers;
+            std::size_t named = 0;
 
-        typedef std::map<std::string, const snowcrash::DataStructure*> ElementMap;
-        ElementMap nameToElement;
+            for (Id id = 0; id < types.size(); ++id) {
+                if (!name(types[id].node).empty()) {
+                    ids[name(types[id].node)] = id;
+                    ++named;
+                }
+            }
 
-        const std::string& parent(const snowcrash::DataStructure* ds) const
-        {
-            return ds->typeDefinition.typeSpecification.name.symbol.literal;
-        }
+            // only named types need to be unique
+            unique_ = ids.size() == named;
 
-        bool hasParent(const snowcrash::DataStructure* ds) const
-        {
-            return !parent(ds).empty();
-        }
+            auto find = [&ids](const std::string& name) {
+                if (name.empty())
+                    return None;
 
-        DependencyTypeInfo(const DataStructures& elements)
-        {
+                auto it = ids.find(name);
+                return it == ids.end() ? None : it->second;
+            };
 
-            // map inheritance && element
-            for (DataStructures::const_iterator i = elements.begin(); i != elements.end(); ++i) {
+            for (Id id = 0; id < types.size(); ++id) {
+                const snowcrash::DataStructure* ds = types[id].node;
 
-                nameToElement[name(i->node)] = &(*i->node);
+                if (!parent(ds).empty()) {
+                    const Id p = find(parent(ds));
 
-                if (hasParent(i->node)) {
-                    childToParent[name(i->node)] = parent(i->node);
+                    if (p != None && p != id) {
+                        parents_[id] = p;
+                        depend(id, p);
+                    }
 
 #ifdef DEBUG_DEPENDENCIES
-                    std::cout << "Parent: " << name(i->node) << "=>" << parent(i->node) << std::endl;
+                    std::cout << "Parent: " << name(ds) << "=>" << parent(ds) << std::endl;
 #endif
                 }
-            }
-
-            // Map members
-            MembersMap members;
-            for (DataStructures::const_iterator i = elements.begin(); i != elements.end(); ++i) {
-                members[name(i->node)] = collectMembers(i->node);
-            }
 
-            // Map members into deep
-            for (MembersMap::const_iterator i = members.begin(); i != members.end(); ++i) {
-                Members resolved;
-                objectToMembers[i->first] = collectMembers(i->first, members, resolved);
-            }
+                for (const auto& member : collectMembers(ds)) {
+                    const Id m = find(member);
 
-#ifdef DEBUG_DEPENDENCIES
-            // debug out members
-            for (MembersMap::const_iterator i = objectToMembers.begin(); i != objectToMembers.end(); ++i) {
-                std::cout << "Members: " << i->first << std::endl;
-                for (Members::const_iterator it = objectToMembers[i->first].begin();
-                     it != objectToMembers[i->first].end();
-                     ++it) {
-                    std::cout << " - " << *it << std::endl;
+                    if (m != None)
+                        depend(id, m);
                 }
             }
-#endif /* DEBUG_DEPENDENCIES */
         }
 
-        bool hasMember(const snowcrash::DataStructure* object, const snowcrash::DataStructure* member) const
+        /**
+         *  \brief Order types so that each follows all types it depends on
+         *
+         *  Of the types whose dependencies are all ordered already, the one
+         *  of the least name comes first; a dependency cycle is broken at its
+         *  type of the least name.
+         *
+         *  \return Ids of all types in order
+         */
+        std::vector<Id> order() const
         {
-            MembersMap::const_iterator members = objectToMembers.find(name(object));
-            if (members == objectToMembers.end()) {
-                return false;
-            }
+            const std::size_t size = types_.size();
 
-            return members->second.find(name(member)) != members->second.end();
-        }
+            // rank of each type by name, a min-heap of ranks yields the least name
+            std::vector<Id> byName(size);
+            for (Id id = 0; id < size; ++id)
+                byName[id] = id;
 
-        bool hasAncestor(const snowcrash::DataStructure* object, const snowcrash::DataStructure* ancestor) const
-        {
-            std::vector<std::string> symbols;
+            std::stable_sort(byName.begin(), byName.end(), [this](Id a, Id b) {
+                return name(types_[a].node) < name(types_[b].node);
+            });
+
+            std::vector<std::size_t> rank(size);
+            for (std::size_t r = 0; r < size; ++r)
+                rank[byName[r]] = r;
+
+            std::vector<std::size_t> pending(dependencies_);
+            std::vector<bool> ordered(size, false);
+            std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t> > ready;
+
+            for (Id id = 0; id < size; ++id)
+                if (pending[id] == 0)
+                    ready.push(rank[id]);
 
-            const std::string& object_typename = name(object);
-            const std::string& ancestor_typename = name(ancestor);
+            std::vector<Id> result;
+            result.reserve(size);
 
-            auto current_typename = object_typename;
+            std::size_t cycleCandidate = 0;
+
+            while (result.size() < size) {
+                if (ready.empty()) {
+                    // all remaining types are on or behind a cycle
+                    while (ordered[byName[cycleCandidate]])
+                        ++cycleCandidate;
+
+                    pending[byName[cycleCandidate]] = 0;
+                    ready.push(cycleCandidate);
+
+#ifdef DEBUG_DEPENDENCIES
+                    std::cout << "Cycle broken at: " << name(types_[byName[cycleCandidate]].node) << std::endl;
+#endif
+                }
 
-            while (true) {
-                if (current_typename == ancestor_typename)
-                    return true; // found ancestor (happy path)
-                auto next_typename = childToParent.find(current_typename);
-                if (next_typename == childToParent.end())
-                    return false; // arrived at the end
+                const Id id = byName[ready.top()];
+                ready.pop();
 
-                if (symbols.end() != std::find(symbols.begin(), symbols.end(), current_typename))
-                    return false; // circular reference
-                symbols.emplace_back(current_typename);
-                current_typename = next_typename->second;
+                ordered[id] = true;
+                result.push_back(id);
+
+                for (const Id dependent : dependents_[id])
+                    if (!ordered[dependent] && pending[dependent] > 0 && --pending[dependent] == 0)
+                        ready.push(rank[dependent]);
             }
 
-            return false;
+            return result;
         }
 
-        mson::BaseTypeName GetType(const snowcrash::DataStructure* ds) const
+        /**
+         *  \brief Partition ordered types into levels of mutually independent types
+         *
+         *  Each type is of a level above all of its dependencies, so converting
+         *  the levels one after another, a type sees just the same converted
+         *  types as in given order. That does not hold where the order breaks
+         *  a cycle or types share a name.
+         *
+         *  \return Levels, each in given order, or none if given order breaks a cycle
+         *          or types share a name
+         */
+        std::vector<std::vector<Id> > levels(const std::vector<Id>& order) const
         {
-            return ds->typeDefinition.typeSpecification.name.base;
-        }
+            std::vector<std::vector<Id> > result;
 
-        mson::BaseTypeName ResolveType(const snowcrash::DataStructure* object) const
-        {
-            std::string s = name(object);
+            if (!unique_)
+                return result;
 
-            while (!s.empty()) {
-                ElementMap::const_iterator ei = nameToElement.find(s);
-                if (ei == nameToElement.end()) {
-                    return mson::UndefinedTypeName;
-                }
+            std::vector<std::size_t> position(types_.size());
+            for (std::size_t p = 0; p < order.size(); ++p)
+                position[order[p]] = p;
 
-                mson::BaseTypeName type = GetType(ei->second);
+            std::vector<std::size_t> level(types_.size(), 0);
 
-                if (type != mson::UndefinedTypeName) {
-                    return type;
-                }
+            for (const Id id : order) {
+                if (result.size() <= level[id])
+                    result.resize(level[id] + 1);
+
+                result[level[id]].push_back(id);
+
+                for (const Id dependent : dependents_[id]) {
+                    if (position[dependent] < position[id])
+                        return std::vector<std::vector<Id> >();
 
-                InheritanceMap::const_iterator i = childToParent.find(s);
-                if (i == childToParent.end() || (s == i->second)) {
-                    return mson::UndefinedTypeName;
+                    level[dependent] = std::max(level[dependent], level[id] + 1);
                 }
+            }
+
+            return result;
+        }
 
-                s = i->second;
+        /** \return Base type of a type, inherited from its ancestors if not defined */
+        mson::BaseTypeName resolveType(Id id) const
+        {
+            // bounded by the number of types in case of an inheritance cycle
+            for (std::size_t depth = 0; id != None && depth < types_.size(); ++depth) {
+                const mson::BaseTypeName type = types_[id].node->typeDefinition.typeSpecification.name.base;
+
+                if (type != mson::UndefinedTypeName)
+                    return type;
+
+                id = parents_[id];
             }
 
             return mson::UndefinedTypeName;
         }
     };
 
-    struct InheritanceComparator {
+    const DependencyGraph::Id DependencyGraph::None;
 
-        const DependencyTypeInfo& typeInfo;
+    /**
+     *  \brief Replace the preregistered element of a named type by its conversion
+     */
+    void RegisterConverted(const NodeInfo<snowcrash::DataStructure>& ds,
+        std::unique_ptr<IElement> element,
+        ConversionContext& context)
+    {
+        const std::string& name = ds.node->name.symbol.literal;
 
-        InheritanceComparator(const DependencyTypeInfo& typeInfo) : typeInfo(typeInfo) {}
+#ifdef DEBUG_DEPENDENCIES
+        TypeQueryVisitor v;
+        v.visit(*element);
+        std::cout << name << " [" << v.get() << "]" << std::endl;
+#endif /* DEBUG_DEPENDENCIES */
 
-        /* This is a comparator for std::sort so it has to compare
-         * objects in strictly weak ordering otherwise it would crash
-         * with sort going out of container bounds, see
-         * http://stackoverflow.com/questions/24048022/what-causes-stdsort-to-access-address-out-of-range
-         * for more details.
-         * The order is following, if F has S as an ancestor or a member
-         * then S < F and conversely, if none of this applies we compare objects by
-         * names to provide some ordering for all objects as we don't
-         * really care.
-         */
-        bool operator()(DataStructures::const_reference first, DataStructures::const_reference second)
-        {
+        // remove preregistrated element
+        context.typeRegistry().remove(name);
 
-            if (typeInfo.hasAncestor(first.node, second.node) || typeInfo.hasMember(first.node, second.node)) {
-                return false;
-            }
+        try {
+            context.typeRegistry().add(std::move(element));
+        } catch (LogicError& e) {
+            std::ostringstream out;
+            out << name << " is a reserved keyword and cannot be used.";
+            throw snowcrash::Error(out.str(), snowcrash::MSONError, ds.sourceMap->name.sourceMap);
+        }
+    }
 
-            if (typeInfo.hasAncestor(second.node, first.node) || typeInfo.hasMember(second.node, first.node)) {
-                return true;
-            }
+    /**
+     *  \brief Call @f with each of [0, count), spread over at most @threads threads
+     *
+     *  Threads take the next index once done with the previous one, so a few
+     *  costly calls do not hold back the rest. @f must not throw.
+     */
+    template <typename F>
+    void ForEachConcurrently(std::size_t count, unsigned int threads, F f)
+    {
+        std::atomic<std::size_t> next{ 0 };
+
+        auto work = [&next, count, &f]() {
+            for (std::size_t i = next++; i < count; i = next++)
+                f(i);
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t t = 1; t < threads && t < count; ++t)
+            workers.emplace_back(work);
+
+        work();
+
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    using Levels = std::vector<std::vector<DependencyGraph::Id> >;
+
+    /**
+     *  \brief Convert named types level by level, types of a level concurrently
+     *
+     *  The registry is modified by the calling thread only, between levels.
+     *  Warnings are buffered per type and merged in the dependency order, and
+     *  the first error in that order is rethrown, so the result is the same
+     *  as of converting types one by one.
+     */
+    void ConvertConcurrently(const DataStructures& found,
+        const std::vector<DependencyGraph::Id>& order,
+        const Levels& levels,
+        unsigned int threads,
+        ConversionContext& context)
+    {
+        struct Conversion {
+            std::unique_ptr<IElement> element;
+            ConversionContext::Warnings warnings;
+            std::exception_ptr error;
+        };
+
+        std::vector<Conversion> conversions(found.size());
+
+        std::vector<std::size_t> position(found.size());
+        for (std::size_t p = 0; p < order.size(); ++p)
+            position[order[p]] = p;
+
+        // types ordered after a failed one are not converted, just like one by one
+        std::size_t failed = order.size();
+
+        for (const auto& level : levels) {
+            ForEachConcurrently(level.size(), threads, [&](std::size_t i) {
+                const auto id = level[i];
+                const auto& ds = found[id];
 
-            return name(first.node) < name(second.node);
+                if (position[id] > failed || ds.node->name.symbol.literal.empty())
+                    return;
+
+                Conversion& conversion = conversions[id];
+
+                // nothing may escape the thread, failures are rethrown in order by the calling thread
+                try {
+                    ConversionContext::WarningsBuffer buffer(context);
+
+                    try {
+                        conversion.element = MSONToRefract(ds, context);
+                    } catch (...) {
+                        conversion.error = std::current_exception();
+                    }
+
+                    conversion.warnings = buffer.warnings();
+                } catch (...) {
+                    conversion.error = std::current_exception();
+                }
+            });
+
+            for (const auto id : level) {
+                Conversion& conversion = conversions[id];
+
+                if (!conversion.error && conversion.element) {
+                    try {
+                        RegisterConverted(found[id], std::move(conversion.element), context);
+                    } catch (...) {
+                        conversion.error = std::current_exception();
+                    }
+                }
+
+                if (conversion.error)
+                    failed = std::min(failed, position[id]);
+            }
         }
-    };
 
+        for (const auto id : order) {
+            Conversion& conversion = conversions[id];
+
+            for (const auto& warning : conversion.warnings)
+                context.warn(warning);
+
+            if (conversion.error)
+                std::rethrow_exception(conversion.error);
+        }
+    }
 }
 
 namespace drafter
@@ -408,19 +594,19 @@ namespace drafter
         std::cout << "==DEPENDENCIES INFO BEGIN==" << std::endl;
 #endif /* DEBUG_DEPENDENCIES */
 
-        DependencyTypeInfo typeInfo(found);
-
-        std::sort(found.begin(), found.end(), InheritanceComparator(typeInfo));
+        const DependencyGraph graph(found);
+        const std::vector<DependencyGraph::Id> order = graph.order();
 
 #ifdef DEBUG_DEPENDENCIES
         std::cout << "==BASE TYPE ORDER==" << std::endl;
 #endif /* DEBUG_DEPENDENCIES */
 
         // first level registration - we will create empty elements with correct type info
-        for (DataStructures::const_iterator i = found.begin(); i != found.end(); ++i) {
-            const std::string& name = i->node->name.symbol.literal;
+        for (const auto id : order) {
+            const auto& ds = found[id];
+            const std::string& name = ds.node->name.symbol.literal;
 
-            const RefractElementFactory& factory = FactoryFromType(typeInfo.ResolveType(i->node));
+            const RefractElementFactory& factory = FactoryFromType(graph.resolveType(id));
             auto element = factory.Create(std::string(), eValue);
             element->meta().set("id", from_primitive(name));
 
@@ -429,33 +615,21 @@ namespace drafter
             } catch (LogicError& e) {
                 std::ostringstream out;
                 out << name << " is a reserved keyword and cannot be used.";
-                throw snowcrash::Error(out.str(), snowcrash::MSONError, i->sourceMap->name.sourceMap);
+                throw snowcrash::Error(out.str(), snowcrash::MSONError, ds.sourceMap->name.sourceMap);
             }
         }
 
-        for (DataStructures::const_iterator i = found.begin(); i != found.end(); ++i) {
-
-            if (!i->node->name.symbol.literal.empty()) {
-
-                const std::string& name = i->node->name.symbol.literal;
-                auto element = MSONToRefract(*i, context);
+        const unsigned int threads = get_conversion_threads(context.options());
+        const Levels levels = threads > 1 ? graph.levels(order) : Levels();
 
-#ifdef DEBUG_DEPENDENCIES
-                TypeQueryVisitor v;
-                v.visit(*element);
-                std::cout << name << " [" << v.get() << "]" << std::endl;
-#endif /* DEBUG_DEPENDENCIES */
-
-                // remove preregistrated element
-                context.typeRegistry().remove(name);
+        if (!levels.empty()) {
+            ConvertConcurrently(found, order, levels, threads, context);
+        } else {
+            for (const auto id : order) {
+                const auto& ds = found[id];
 
-                try {
-                    context.typeRegistry().add(std::move(element));
-                } catch (LogicError& e) {
-                    std::ostringstream out;
-                    out << name << " is a reserved keyword and cannot be used.";
-                    throw snowcrash::Error(out.str(), snowcrash::MSONError, i->sourceMap->name.sourceMap);
-                }
+                if (!ds.node->name.symbol.literal.empty())
+                    RegisterConverted(ds, MSONToRefract(ds, context), context);
             }
         }
 
@@ -14,11 +14,8 @@
 #include "RefractSourceMap.h"
 
 #include "refract/Exception.h"
-#include "refract/JsonValue.h"
-#include "refract/JsonSchema.h"
 
 #include "utils/log/Trivial.h"
-#include "utils/so/JsonIo.h"
 
 #include <apib/syntax/MediaType.h>
 #include <apib/parser/MediaTypeParser.h>
@@ -242,12 +239,12 @@ std::unique_ptr<IElement> HeaderToRefract(const NodeInfo<snowcrash::Header>& hea
 namespace
 {
     std::unique_ptr<StringElement> make_asset_element( //
-        std::string content,                           //
+        dsd::String content,                           //
         std::string klass,                             //
         std::string contentType,                       //
         const mdp::CharactersRangeSet* sourceMap = nullptr)
     {
-        auto result = from_primitive_t(SerializeKey::Asset, std::move(content));
+        auto result = refract::make_unique<StringElement>(SerializeKey::Asset, std::move(content));
 
         if (!klass.empty())
             result->meta().set(SerializeKey::Classes, //
@@ -281,32 +278,30 @@ namespace
         return media_type{ "text", "plain", "", {} };
     }
 
+    // deferred assets are generated when first serialised
     void generateValueAsset( //
         ArrayElement::ValueType& out,
-        const ConversionContext& context,
-        const IElement& expanded,
-        const media_type& mediaType)
+        const std::shared_ptr<GeneratedAssets::Entry>& generated,
+        const media_type& mediaType,
+        bool deferred)
     {
         using apib::backend::serialize;
-        if (apib::isJSON(mediaType)) {
-            std::stringstream ss{};
-            drafter::utils::so::serialize_json(ss, refract::generateJsonValue(expanded));
-            out.push_back(make_asset_element(ss.str(), SerializeKey::MessageBody, serialize(mediaType)));
-        }
+        out.push_back(make_asset_element( //
+            deferred ? dsd::String(GeneratedAssets::deferredBody(generated)) : dsd::String(generated->body()),
+            SerializeKey::MessageBody,
+            serialize(mediaType)));
     }
 
     void generateSchemaAsset( //
         ArrayElement::ValueType& out,
-        const ConversionContext& context,
-        const IElement& expanded,
-        const media_type& mediaType)
+        const std::shared_ptr<GeneratedAssets::Entry>& generated,
+        bool deferred)
     {
         using apib::backend::serialize;
-        if (apib::isJSON(mediaType)) {
-            std::stringstream ss{};
-            drafter::utils::so::serialize_json(ss, refract::schema::generateJsonSchema(expanded));
-            out.push_back(make_asset_element(ss.str(), SerializeKey::MessageBodySchema, serialize(jsonSchemaType())));
-        }
+        out.push_back(make_asset_element( //
+            deferred ? dsd::String(GeneratedAssets::deferredSchema(generated)) : dsd::String(generated->schema()),
+            SerializeKey::MessageBodySchema,
+            serialize(jsonSchemaType())));
     }
 
     void attachDataStructure(std::unique_ptr<IElement> ds, ArrayElement::ValueType& out)
@@ -314,11 +309,45 @@ namespace
         out.push_back(refract::make_unique<HolderElement>(SerializeKey::DataStructure, dsd::Holder(std::move(ds))));
     }
 
+    /**
+     *  \brief Attributes of an action, converted once and shared by all of its payloads without attributes
+     */
+    class ActionAttributes
+    {
+        std::unique_ptr<IElement> converted_;
+        std::unique_ptr<IElement> expanded_;
+        std::shared_ptr<GeneratedAssets::Entry> generated_;
+
+    public:
+        explicit ActionAttributes(std::unique_ptr<IElement> converted = nullptr) noexcept
+            : converted_(std::move(converted)), expanded_(), generated_()
+        {
+        }
+
+        /** \brief Expand the attributes, unless expanded already */
+        void expand(ConversionContext& context)
+        {
+            if (converted_)
+                expanded_ = ExpandRefract(std::move(converted_), context);
+        }
+
+        /** \return Assets of the expanded attributes; NULL if there are no attributes */
+        const std::shared_ptr<GeneratedAssets::Entry>& generated(ConversionContext& context)
+        {
+            expand(context);
+
+            if (expanded_)
+                generated_ = context.generatedAssets().find(std::move(expanded_));
+
+            return generated_;
+        }
+    };
 }
 
 std::unique_ptr<IElement> PayloadToRefract( //
     const NodeInfo<snowcrash::Payload>& payload,
     const NodeInfo<snowcrash::Action>& action,
+    ActionAttributes* actionAttributes,
     ConversionContext& context)
 {
     using namespace snowcrash;
@@ -387,10 +416,24 @@ std::unique_ptr<IElement> PayloadToRefract( //
         getContentTypeFromHeaders(payload.node->headers) //
     );
 
-    // Determine any MSON to generate value/schema
-    if (!dataStructure && !action.isNull() && !action.node->attributes.empty())
-        dataStructure = MSONToRefract(MAKE_NODE_INFO(action, attributes), context);
-    auto dataStructureExpanded = dataStructure ? ExpandRefract(std::move(dataStructure), context) : nullptr;
+    const bool generateBody = payload.node->body.empty() && !is_skip_gen_bodies(context.options());
+    const bool generateSchema = payload.node->schema.empty() && !is_skip_gen_body_schemas(context.options());
+
+    // Determine any MSON to generate value/schema, expanded even if not generating to report its errors
+    std::unique_ptr<IElement> dataStructureExpanded;
+    if (dataStructure)
+        dataStructureExpanded = ExpandRefract(std::move(dataStructure), context);
+    else if (actionAttributes)
+        actionAttributes->expand(context);
+
+    // assets of equal data structures are generated once per conversion
+    std::shared_ptr<GeneratedAssets::Entry> generated;
+    if (apib::isJSON(mediaType) && (generateBody || generateSchema)) {
+        if (dataStructureExpanded)
+            generated = context.generatedAssets().find(std::move(dataStructureExpanded));
+        else if (actionAttributes)
+            generated = actionAttributes->generated(context);
+    }
 
     // Push Body Asset
     if (!payload.node->body.empty()) {
@@ -400,9 +443,9 @@ std::unique_ptr<IElement> PayloadToRefract( //
             serialize(mediaType),
             &payload.sourceMap->body.sourceMap));
 
-    } else if (dataStructureExpanded && !is_skip_gen_bodies(context.options())) {
+    } else if (generated && generateBody) {
         // otherwise, generate one from attributes
-        generateValueAsset(content, context, *dataStructureExpanded, mediaType);
+        generateValueAsset(content, generated, mediaType, is_lazy_gen_bodies(context.options()));
     }
 
     // Push Schema Asset
@@ -413,9 +456,9 @@ std::unique_ptr<IElement> PayloadToRefract( //
             serialize(apib::isJSON(mediaType) ? jsonSchemaType() : textPlainType()),
             &payload.sourceMap->schema.sourceMap));
 
-    } else if (dataStructureExpanded && !is_skip_gen_body_schemas(context.options())) {
+    } else if (generated && generateSchema) {
         // otherwise, generate one from attributes
-        generateSchemaAsset(content, context, *dataStructureExpanded, mediaType);
+        generateSchemaAsset(content, generated, is_lazy_gen_bodies(context.options()));
     }
 
     return std::move(result);
@@ -423,6 +466,7 @@ std::unique_ptr<IElement> PayloadToRefract( //
 
 std::unique_ptr<ArrayElement> TransactionToRefract(const NodeInfo<snowcrash::TransactionExample>& transaction,
     const NodeInfo<snowcrash::Action>& action,
+    ActionAttributes& actionAttributes,
     const NodeInfo<snowcrash::Request>& request,
     const NodeInfo<snowcrash::Response>& response,
     ConversionContext& context)
@@ -434,8 +478,8 @@ std::unique_ptr<ArrayElement> TransactionToRefract(const NodeInfo<snowcrash::Tra
 
     if (!transaction.node->description.empty())
         content.push_back(CopyToRefract(MAKE_NODE_INFO(transaction, description)));
-    content.push_back(PayloadToRefract(request, action, context));
-    content.push_back(PayloadToRefract(response, NodeInfo<snowcrash::Action>(), context));
+    content.push_back(PayloadToRefract(request, action, &actionAttributes, context));
+    content.push_back(PayloadToRefract(response, NodeInfo<snowcrash::Action>(), nullptr, context));
 
     RemoveEmptyElements(content);
 
@@ -465,9 +509,21 @@ std::unique_ptr<ArrayElement> ActionToRefract(const NodeInfo<snowcrash::Action>&
             SerializeKey::HrefVariables, ParametersToRefract(MAKE_NODE_INFO(action, parameters), context));
     }
 
+    // converted once for the data of the action and all of its payloads
+    ActionAttributes actionAttributes;
+
     if (!action.node->attributes.empty()) {
-        element->attributes().set(
-            SerializeKey::Data, DataStructureToRefract(MAKE_NODE_INFO(action, attributes), context));
+        if (auto attributes = MSONToRefract(MAKE_NODE_INFO(action, attributes), context)) {
+            actionAttributes = ActionAttributes(clone(*attributes));
+
+            if (context.expandMson())
+                attributes = ExpandRefract(std::move(attributes), context);
+
+            element->attributes().set(SerializeKey::Data,
+                refract::make_unique<HolderElement>(SerializeKey::DataStructure, dsd::Holder(std::move(attributes))));
+        } else {
+            element->attributes().set(SerializeKey::Data, nullptr);
+        }
     }
 
     auto& content = element->get();
@@ -487,8 +543,8 @@ std::unique_ptr<ArrayElement> ActionToRefract(const NodeInfo<snowcrash::Action>&
             ResponsesType responses(example.node->responses, example.sourceMap->responses);
 
             for (const auto& response : responses) {
-                content.push_back(
-                    TransactionToRefract(example, action, NodeInfo<snowcrash::Request>(), response, context));
+                content.push_back(TransactionToRefract(
+                    example, action, actionAttributes, NodeInfo<snowcrash::Request>(), response, context));
             }
         }
 
@@ -499,15 +555,15 @@ std::unique_ptr<ArrayElement> ActionToRefract(const NodeInfo<snowcrash::Action>&
         for (const auto& request : requests) {
 
             if (example.node->responses.empty()) {
-                content.push_back(
-                    TransactionToRefract(example, action, request, NodeInfo<snowcrash::Response>(), context));
+                content.push_back(TransactionToRefract(
+                    example, action, actionAttributes, request, NodeInfo<snowcrash::Response>(), context));
             }
 
             typedef NodeInfoCollection<snowcrash::Responses> ResponsesType;
             ResponsesType responses(example.node->responses, example.sourceMap->responses);
 
             for (const auto& response : responses) {
-                content.push_back(TransactionToRefract(example, action, request, response, context));
+                content.push_back(TransactionToRefract(example, action, actionAttributes, request, response, context));
             }
         }
     }
@@ -19,6 +19,7 @@
 #include "NamedTypesRegistry.h"
 #include "RefractElementFactory.h"
 #include "ConversionContext.h"
+#include "stats.h"
 
 #include "ElementData.h"
 #include "refract/ElementUtils.h"
@@ -366,7 +367,8 @@ namespace
             case TypeQueryVisitor::Ref:
             case TypeQueryVisitor::Extend:
             case TypeQueryVisitor::Option:
-            case TypeQueryVisitor::Select:;
+            case TypeQueryVisitor::Select:
+            case TypeQueryVisitor::SourceMap:;
         };
         return mson::UndefinedTypeName;
     }
@@ -1332,14 +1334,19 @@ std::unique_ptr<IElement> drafter::ExpandRefract(std::unique_ptr<IElement> eleme
         return nullptr;
     }
 
-    ExpandVisitor expander(context.typeRegistry());
+    StageScope stage(DRAFTER_STAGE_EXPANSION);
+
+    ExpandVisitor expander(context.typeRegistry(), &context.expandedTypes());
     Visit(expander, *element);
 
-    if (auto expanded = expander.get()) {
-        return expanded;
-    }
+    auto expanded = expander.get();
+    if (!expanded)
+        expanded = std::move(element);
+
+    stage.stop();
+    stage.addElements(*expanded);
 
-    return element;
+    return expanded;
 }
 
 // OPTIM @tjanc@ move implementation to MsonMemberToApie.cc
@@ -5,54 +5,44 @@ using namespace refract;
 
 namespace
 {
-    std::unique_ptr<IElement> CharacterRangeToRefract(const mdp::CharactersRange& sourceMap)
+    dsd::SourceMap::Range CharacterRangeToRefract(const mdp::CharactersRange& sourceMap)
     {
-        return make_element<ArrayElement>( //
-            from_primitive(sourceMap.location),
-            from_primitive(sourceMap.length));
+        return { sourceMap.location, sourceMap.length };
     }
 
 } // namespace
 
 std::unique_ptr<IElement> drafter::SourceMapToRefract(const mdp::CharactersRangeSet& sourceMap)
 {
-    auto sourceMapElement = make_element<ArrayElement>();
-    sourceMapElement->element(SerializeKey::SourceMap);
+    std::vector<dsd::SourceMap::Range> ranges;
+    ranges.reserve(sourceMap.size());
 
     std::transform( //
         sourceMap.begin(),
         sourceMap.end(),
-        std::back_inserter(sourceMapElement->get()),
+        std::back_inserter(ranges),
         CharacterRangeToRefract);
 
-    return make_element<ArrayElement>(std::move(sourceMapElement));
+    return make_element<ArrayElement>(make_element<SourceMapElement>(dsd::SourceMap{ std::move(ranges) }));
 }
 
 std::unique_ptr<IElement> drafter::SourceMapToRefractWithColumnLineInfo(
     const mdp::CharactersRangeSet& sourceMap, const ConversionContext& context)
 {
-    auto sourceMapElement = make_element<ArrayElement>();
-    sourceMapElement->element(SerializeKey::SourceMap);
+    std::vector<dsd::SourceMap::Range> ranges;
+    std::vector<dsd::SourceMap::Span> spans;
+    ranges.reserve(sourceMap.size());
+    spans.reserve(sourceMap.size());
 
-    std::transform( //
-        sourceMap.begin(),
-        sourceMap.end(),
-        std::back_inserter(sourceMapElement->get()),
-        [&context](const mdp::CharactersRange& sourceMap) {
-            auto position = GetLineFromMap(context.newlineIndices(), sourceMap);
+    for (const auto& range : sourceMap) {
+        auto position = GetLineFromMap(context.newlineIndices(), range);
 
-            auto location = make_element<NumberElement>(sourceMap.location);
-            location->attributes().set("line", from_primitive(position.fromLine));
-            location->attributes().set("column", from_primitive(position.fromColumn));
-
-            auto length = make_element<NumberElement>(sourceMap.length);
-            length->attributes().set("line", from_primitive(position.toLine));
-            length->attributes().set("column", from_primitive(position.toColumn));
-
-            return make_element<ArrayElement>(std::move(location), std::move(length));
-        });
+        ranges.push_back(CharacterRangeToRefract(range));
+        spans.push_back({ position.fromLine, position.fromColumn, position.toLine, position.toColumn });
+    }
 
-    return make_element<ArrayElement>(std::move(sourceMapElement));
+    return make_element<ArrayElement>(
+        make_element<SourceMapElement>(dsd::SourceMap{ std::move(ranges), std::move(spans) }));
 }
 
 std::unique_ptr<StringElement> drafter::LiteralToRefract(
@@ -60,6 +60,8 @@ std::unique_ptr<IElement> drafter::WrapRefract(
         }
 
         context.typeRegistry().clear();
+        context.expandedTypes().clear();
+        context.generatedAssets().clear();
 
         if (error.code != snowcrash::Error::OK) {
             blueprint.report.error = error;
@@ -1,8 +1,6 @@
 #include "SourceMapUtils.h"
 #include <algorithm>
 
-#include "utils/Utf8.h"
-
 #include <iostream>
 
 namespace drafter
@@ -51,21 +49,14 @@ namespace drafter
 
     const NewLinesIndex GetLinesEndIndex(const std::string& source)
     {
+        return GetLinesEndIndex(source.c_str(), source.length());
+    }
 
-        NewLinesIndex out;
-
-        out.push_back(0);
-
-        utils::utf8::input_iterator<std::string::const_iterator> it(source);
-        utils::utf8::input_iterator<std::string::const_iterator> e{ source.end(), source.end() };
-
-        int i = 1;
-        for (; it != e; ++it, ++i) {
-            if (*it == '\n')
-                out.push_back(i);
-        }
-
-        return out;
+    const NewLinesIndex GetLinesEndIndex(const char* source, std::size_t size)
+    {
+        mdp::ByteBufferCharacterIndex index;
+        mdp::BuildCharacterIndex(index, source, size);
+        return index.lines();
     }
 
 } // namespace drafter
@@ -34,11 +34,17 @@ namespace drafter
 
     /**
      *  \brief Given the source returns the length of all the lines in source as a vector
+     *  \remark prefer mdp::ByteBufferCharacterIndex::lines() of an index built anyway
      *  \param source Source data
      *  \param out Vector containing indexes of all end line character in source
      */
     const NewLinesIndex GetLinesEndIndex(const std::string& source);
 
+    /**
+     *  \brief Same as GetLinesEndIndex(source) for \p size bytes at \p source
+     */
+    const NewLinesIndex GetLinesEndIndex(const char* source, std::size_t size);
+
 } // namespace drafter
 
 #endif
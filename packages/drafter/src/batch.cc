@@ -0,0 +1,225 @@
+//
+//  batch.cc
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "batch.h"
+
+#include "drafter.h"
+#include "input.h"
+#include "reporting.h"
+
+#include "utils/log/Trivial.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    int WriteToStream(const char* data, size_t size, void* user)
+    {
+        std::ostream& out = *static_cast<std::ostream*>(user);
+        out.write(data, size);
+        return out ? 0 : 1;
+    }
+
+    /**
+     *  \brief Parse state kept by a worker thread for all files it processes
+     */
+    class Worker
+    {
+        const Config& config_;
+        drafter_parse_context* context_;
+        drafter_parse_options* parseOptions_;
+        drafter_serialize_options* serializeOptions_;
+
+    public:
+        Worker(const Config& config, drafter_stats* stats)
+            : config_(config),
+              context_(drafter_init_parse_context()),
+              parseOptions_(drafter_init_parse_options()),
+              serializeOptions_(drafter_init_serialize_options())
+        {
+            if (config.sourceMap)
+                drafter_set_sourcemaps_included(serializeOptions_);
+            if (config.format == drafter::JSONFormat)
+                drafter_set_format(serializeOptions_, DRAFTER_SERIALIZE_JSON);
+
+            if (config.validate) // nothing is serialised, so bodies are never generated
+                drafter_set_lazy_gen_bodies(parseOptions_);
+
+            drafter_set_parse_stats(parseOptions_, stats);
+            drafter_set_serialize_stats(serializeOptions_, stats);
+        }
+
+        ~Worker()
+        {
+            drafter_free_serialize_options(serializeOptions_);
+            drafter_free_parse_options(parseOptions_);
+            drafter_free_parse_context(context_);
+        }
+
+        Worker(const Worker&) = delete;
+        Worker& operator=(const Worker&) = delete;
+
+        /**
+         *  \brief Parse a file, write its Parse Result and report
+         *  \return Parse error code, -1 if the file could not be read or written
+         */
+        int process(const std::string& file, std::ostream& report)
+        {
+            Input in(file);
+
+            if (!in.good()) {
+                report << "\nfatal: unable to open file '" << file << "'\n";
+                return -1;
+            }
+
+            drafter_result* result = nullptr;
+            int ret = drafter_parse_blueprint_buffer_with_context(
+                context_, in.data(), in.size(), &result, parseOptions_);
+
+            if (!result) {
+                report << "\nfatal: unable to parse file '" << file << "'\n";
+                return -1;
+            }
+
+            if (!config_.validate) {
+                const std::string output = file + (config_.format == drafter::JSONFormat ? ".json" : ".yaml");
+                std::ofstream out(output.c_str(), std::ios_base::binary);
+
+                if (out.is_open()
+                    && drafter_serialize_to_callback(result, serializeOptions_, WriteToStream, &out) == DRAFTER_OK) {
+                    out << "\n";
+                }
+
+                if (!out.is_open() || !out.flush()) {
+                    report << "\nfatal: unable to write file '" << output << "'";
+                    ret = -1;
+                }
+            }
+
+            PrintReport(result, in.data(), in.size(), config_.lineNumbers, ret, report);
+
+            drafter_free_result(result);
+
+            return ret;
+        }
+    };
+
+    /** \return Non-empty lines of given file */
+    bool ReadList(const std::string& file, std::vector<std::string>& out)
+    {
+        std::ifstream in(file.c_str());
+
+        if (!in.is_open())
+            return false;
+
+        std::string line;
+        while (std::getline(in, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (!line.empty())
+                out.push_back(line);
+        }
+
+        return true;
+    }
+}
+
+int ProcessBatch(const Config& config)
+{
+    if (config.enableLog)
+        ENABLE_LOGGING;
+
+    std::vector<std::string> files;
+
+    if (!ReadList(config.batch, files)) {
+        std::cerr << "fatal: unable to open file '" << config.batch << "'\n";
+        return EXIT_FAILURE;
+    }
+
+    unsigned int jobs = config.jobs ? config.jobs : std::thread::hardware_concurrency();
+    jobs = std::max(1u, std::min<unsigned int>(jobs, files.size()));
+
+    struct Outcome {
+        int status = 0;
+        bool done = false;
+        std::string report;
+    };
+
+    std::vector<Outcome> outcomes(files.size());
+    std::vector<drafter_stats*> stats(jobs, nullptr);
+
+    std::atomic<std::size_t> next{ 0 };
+    std::mutex mutex;
+    std::size_t printed = 0;
+
+    auto work = [&](unsigned int id) {
+        if (config.stats)
+            stats[id] = drafter_init_stats();
+
+        Worker worker(config, stats[id]);
+
+        for (std::size_t i = next++; i < files.size(); i = next++) {
+            std::ostringstream report;
+            const int status = worker.process(files[i], report);
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            outcomes[i].status = status;
+            outcomes[i].done = true;
+            outcomes[i].report = report.str();
+
+            // reports are printed in the order of the list, as soon as all preceding are done
+            for (; printed < files.size() && outcomes[printed].done; ++printed) {
+                std::cerr << files[printed] << ":" << outcomes[printed].report << std::flush;
+                std::string().swap(outcomes[printed].report);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int id = 1; id < jobs; ++id)
+        threads.emplace_back(work, id);
+
+    work(0);
+
+    for (auto& thread : threads)
+        thread.join();
+
+    std::size_t failed = 0;
+
+    for (const auto& outcome : outcomes)
+        if (outcome.status != 0)
+            ++failed;
+
+    std::cerr << "\n" << files.size() << " files parsed, " << failed << " failed\n";
+
+    for (std::size_t i = 0; i < files.size(); ++i)
+        if (outcomes[i].status != 0)
+            std::cerr << "  " << files[i] << " (" << outcomes[i].status << ")\n";
+
+    if (config.stats) {
+        for (unsigned int id = 1; id < jobs; ++id)
+            drafter_merge_stats(stats[0], stats[id]);
+
+        std::cerr << "\n";
+        PrintStats(stats[0], std::cerr);
+    }
+
+    for (auto* s : stats)
+        drafter_free_stats(s);
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
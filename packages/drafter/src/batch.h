@@ -0,0 +1,25 @@
+//
+//  batch.h
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_BATCH_H
+#define DRAFTER_BATCH_H
+
+#include "config.h"
+
+/**
+ *  \brief Parse all files listed in config.batch on a pool of config.jobs threads
+ *
+ *  Each Parse Result is written next to its input, as `<input>.json` or
+ *  `<input>.yaml`. Reports are printed to stderr in the order of the list,
+ *  followed by a summary of the failed files.
+ *
+ *  \param config Parsed command line parameters
+ *  \return EXIT_SUCCESS if every file was parsed without error, EXIT_FAILURE otherwise
+ */
+int ProcessBatch(const Config& config);
+
+#endif // #ifndef DRAFTER_BATCH_H
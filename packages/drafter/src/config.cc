@@ -25,6 +25,9 @@ namespace config
     static const std::string Version = "version";
     static const std::string UseLineNumbers = "use-line-num";
     static const std::string EnableLog = "enable-log";
+    static const std::string Stats = "stats";
+    static const std::string Batch = "batch";
+    static const std::string Jobs = "jobs";
 };
 
 void PrepareCommanLineParser(cmdline::parser& parser)
@@ -45,6 +48,17 @@ void PrepareCommanLineParser(cmdline::parser& parser)
     parser.add(
         config::UseLineNumbers, 'u', "use line and row number instead of character index when printing annotation");
     parser.add(config::EnableLog, 'L', "enable logging");
+    parser.add(config::Stats, '\0', "print time, allocations and elements of each stage to stderr");
+    parser.add<std::string>(config::Batch,
+        'b',
+        "parse files listed in given file, one per line, writing each Parse Result next to its file",
+        false);
+    parser.add<int>(config::Jobs,
+        'j',
+        "number of files parsed in parallel by --batch, 0 for one per CPU",
+        false,
+        0,
+        cmdline::range(0, 1024));
 
     std::stringstream ss;
 
@@ -67,6 +81,19 @@ void ValidateParsedCommandLine(const cmdline::parser& parser, const Config& conf
         exit(EXIT_SUCCESS);
     }
 
+    if (!config.batch.empty()) {
+        if (!config.input.empty()) {
+            std::cerr << "no input file expected with --batch, got " << config.input << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        if (parser.exist(config::Output)) {
+            std::cerr << "--output cannot be used with --batch, Parse Results are written next to input files"
+                      << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
     if (config.validate) {
         if (parser.exist(config::Output)) {
             std::cerr << "WARN: While validation is enabled, output file will not be created" << std::endl;
@@ -91,6 +118,9 @@ void ParseCommadLineOptions(int argc, const char* argv[], /* out */ Config& conf
     conf.output = parser.get<std::string>(config::Output);
     conf.sourceMap = parser.exist(config::Sourcemap);
     conf.enableLog = parser.exist(config::EnableLog);
+    conf.stats = parser.exist(config::Stats);
+    conf.batch = parser.get<std::string>(config::Batch);
+    conf.jobs = static_cast<unsigned int>(parser.get<int>(config::Jobs));
 
     ValidateParsedCommandLine(parser, conf);
 }
@@ -21,6 +21,9 @@ struct Config {
     bool sourceMap;
     std::string output;
     bool enableLog;
+    bool stats;
+    std::string batch;
+    unsigned int jobs;
 };
 
 /**
@@ -32,9 +32,14 @@
 
 #include "reporting.h"
 #include "options.h"
+#include "stats.h"
 
+#include <algorithm>
 #include <cstring>
 #include <cassert>
+#include <sstream>
+#include <streambuf>
+#include <thread>
 
 DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
     char** out,
@@ -64,6 +69,82 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
 
 namespace sc = snowcrash;
 
+struct drafter_parse_context {
+    mdp::ByteBuffer source;
+};
+
+namespace
+{
+    std::size_t CountNodes(const mdp::MarkdownNode& node)
+    {
+        std::size_t count = 1;
+
+        for (const auto& child : node.children())
+            count += CountNodes(child);
+
+        return count;
+    }
+
+    /**
+     *  \brief Accounts parsing to the Markdown and API Blueprint stages of collected statistics
+     */
+    class ParseStages final : public sc::ParseObserver
+    {
+        drafter::StageScope markdown_;
+        drafter::StageScope blueprint_;
+
+    public:
+        ParseStages() noexcept : markdown_(DRAFTER_STAGE_MARKDOWN), blueprint_(DRAFTER_STAGE_BLUEPRINT, false) {}
+
+        void markdownParsed(const mdp::MarkdownNode& markdownAST) override
+        {
+            markdown_.stop();
+
+            if (markdown_.enabled())
+                markdown_.addElements(CountNodes(markdownAST));
+
+            blueprint_.start();
+        }
+    };
+
+    drafter_error parse(const mdp::ByteBuffer& source, drafter_result** out, const drafter_parse_options* parse_opts)
+    {
+        drafter::StatsScope collecting(drafter::get_stats(parse_opts));
+
+        sc::BlueprintParserOptions scOptions = sc::ExportSourcemapOption;
+
+        if (drafter::is_name_required(parse_opts)) {
+            scOptions |= sc::RequireBlueprintNameOption;
+        }
+
+        // shared by the parser and the conversion to API Elements
+        mdp::ByteBufferCharacterIndex sourceIndex;
+        sc::ParseResult<sc::Blueprint> blueprint;
+
+        {
+            ParseStages stages;
+            mdp::BuildCharacterIndex(sourceIndex, source);
+            sc::parse(source, sourceIndex, scOptions, blueprint, &stages);
+        }
+
+        drafter::StageScope conversion(DRAFTER_STAGE_CONVERSION);
+
+        drafter::ConversionContext context(sourceIndex, parse_opts);
+        auto result = WrapRefract(blueprint, context);
+
+        conversion.stop();
+
+        if (conversion.enabled())
+            conversion.addElements(*result);
+
+        if (out) {
+            *out = result.release();
+        }
+
+        return (drafter_error)blueprint.report.error.code;
+    }
+} // namespace
+
 /* Parse API Bleuprint and return result, which is a opaque handle for
  * later use*/
 DRAFTER_API drafter_error drafter_parse_blueprint(
@@ -73,25 +154,163 @@ DRAFTER_API drafter_error drafter_parse_blueprint(
         return DRAFTER_EINVALID_INPUT;
     }
 
-    sc::BlueprintParserOptions scOptions = sc::ExportSourcemapOption;
+    return parse(source, out, parse_opts);
+}
+
+DRAFTER_API drafter_error drafter_parse_blueprint_buffer(
+    const char* source, size_t size, drafter_result** out, const drafter_parse_options* parse_opts)
+{
+    if (!source) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    return parse(mdp::ByteBuffer(source, size), out, parse_opts);
+}
+
+DRAFTER_API drafter_parse_context* drafter_init_parse_context()
+{
+    return new drafter_parse_context{};
+}
+
+DRAFTER_API void drafter_free_parse_context(drafter_parse_context* context)
+{
+    delete context;
+}
 
-    if (drafter::is_name_required(parse_opts)) {
-        scOptions |= sc::RequireBlueprintNameOption;
+DRAFTER_API drafter_error drafter_parse_blueprint_with_context(drafter_parse_context* context,
+    const char* source,
+    drafter_result** out,
+    const drafter_parse_options* parse_opts)
+{
+    if (!context || !source) {
+        return DRAFTER_EINVALID_INPUT;
     }
 
-    sc::ParseResult<sc::Blueprint> blueprint;
-    sc::parse(source, scOptions, blueprint);
+    // keeps capacity of the previous source
+    context->source.assign(source);
 
-    drafter::ConversionContext context(source, parse_opts);
-    auto result = WrapRefract(blueprint, context);
+    return parse(context->source, out, parse_opts);
+}
 
-    if (out) {
-        *out = result.release();
+DRAFTER_API drafter_error drafter_parse_blueprint_buffer_with_context(drafter_parse_context* context,
+    const char* source,
+    size_t size,
+    drafter_result** out,
+    const drafter_parse_options* parse_opts)
+{
+    if (!context || !source) {
+        return DRAFTER_EINVALID_INPUT;
     }
 
-    return (drafter_error)blueprint.report.error.code;
+    // keeps capacity of the previous source
+    context->source.assign(source, size);
+
+    return parse(context->source, out, parse_opts);
 }
 
+namespace
+{
+    bool serialize(std::ostream& out, const drafter_result& res, const drafter_serialize_options* serialize_opts)
+    {
+        drafter::StatsScope collecting(drafter::get_stats(serialize_opts));
+        drafter::StageScope serialization(DRAFTER_STAGE_SERIALIZATION, false);
+
+        if (serialization.enabled())
+            serialization.addElements(res);
+
+        serialization.start();
+
+        const bool sourceMaps = drafter::are_sourcemaps_included(serialize_opts);
+
+        switch (drafter::get_format(serialize_opts)) {
+            case DRAFTER_SERIALIZE_JSON: {
+                drafter::utils::so::JsonWriter writer(out);
+                refract::serialize::renderSo(res, sourceMaps, writer);
+                return true;
+            }
+            case DRAFTER_SERIALIZE_YAML: {
+                drafter::utils::so::YamlWriter writer(out);
+                refract::serialize::renderSo(res, sourceMaps, writer);
+                return true;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    /**
+     *  \brief Output buffer handing its content over to drafter_write_callback
+     *
+     *  Once the callback reports a failure the buffer stops accepting output,
+     *  which puts the owning stream into a bad state.
+     */
+    class callback_streambuf final : public std::streambuf
+    {
+        static constexpr std::size_t buffer_size = 4096;
+
+        drafter_write_callback callback_;
+        void* user_;
+        char buffer_[buffer_size];
+        bool failed_ = false;
+
+        bool flush()
+        {
+            const std::size_t size = pptr() - pbase();
+
+            if (size > 0 && !failed_)
+                failed_ = callback_(pbase(), size, user_) != 0;
+
+            setp(buffer_, buffer_ + buffer_size);
+            return !failed_;
+        }
+
+    protected:
+        int_type overflow(int_type c) override
+        {
+            if (!flush())
+                return traits_type::eof();
+
+            if (!traits_type::eq_int_type(c, traits_type::eof()))
+                return sputc(traits_type::to_char_type(c));
+
+            return traits_type::not_eof(c);
+        }
+
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            if (n < epptr() - pptr()) {
+                std::memcpy(pptr(), s, n);
+                pbump(static_cast<int>(n));
+                return n;
+            }
+
+            // hand large chunks over without copying them into the buffer
+            if (!flush())
+                return 0;
+
+            failed_ = callback_(s, n, user_) != 0;
+            return failed_ ? 0 : n;
+        }
+
+        int sync() override
+        {
+            return flush() ? 0 : -1;
+        }
+
+    public:
+        callback_streambuf(drafter_write_callback callback, void* user) : callback_(callback), user_(user)
+        {
+            setp(buffer_, buffer_ + buffer_size);
+        }
+
+        bool failed() const noexcept
+        {
+            return failed_;
+        }
+    };
+} // namespace
+
 /* Serialize result to given format*/
 DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize_options* serialize_opts)
 {
@@ -101,25 +320,35 @@ DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize
 
     std::ostringstream out;
 
-    switch (drafter::get_format(serialize_opts)) {
-        case DRAFTER_SERIALIZE_JSON: {
-            auto soValue = refract::serialize::renderSo(*res, drafter::are_sourcemaps_included(serialize_opts));
-            drafter::utils::so::serialize_json(out, soValue);
-            break;
-        }
-        case DRAFTER_SERIALIZE_YAML: {
-            auto soValue = refract::serialize::renderSo(*res, drafter::are_sourcemaps_included(serialize_opts));
-            drafter::utils::so::serialize_yaml(out, soValue);
-            break;
-        }
-
-        default:
-            return nullptr;
+    if (!serialize(out, *res, serialize_opts)) {
+        return nullptr;
     }
 
     return strdup(out.str().c_str());
 }
 
+/* Serialize result to given format, streaming it into a callback */
+DRAFTER_API drafter_error drafter_serialize_to_callback(drafter_result* res,
+    const drafter_serialize_options* serialize_opts,
+    drafter_write_callback callback,
+    void* user)
+{
+    if (!res || !callback) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    callback_streambuf buffer(callback, user);
+    std::ostream out(&buffer);
+
+    if (!serialize(out, *res, serialize_opts)) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    out.flush();
+
+    return buffer.failed() ? DRAFTER_EINVALID_OUTPUT : DRAFTER_OK;
+}
+
 /* Parse API Blueprint and return only annotations, if NULL than
  * document is error and warning free.*/
 DRAFTER_API drafter_error drafter_check_blueprint(
@@ -196,6 +425,18 @@ DRAFTER_API void drafter_set_skip_gen_body_schemas(drafter_parse_options* opts)
     opts->flags.set(drafter_parse_options::SKIP_GEN_BODY_SCHEMAS);
 }
 
+DRAFTER_API void drafter_set_lazy_gen_bodies(drafter_parse_options* opts)
+{
+    assert(opts);
+    opts->flags.set(drafter_parse_options::LAZY_GEN_BODIES);
+}
+
+DRAFTER_API void drafter_set_conversion_threads(drafter_parse_options* opts, unsigned int threads)
+{
+    assert(opts);
+    opts->conversion_threads = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
 DRAFTER_API drafter_serialize_options* drafter_init_serialize_options()
 {
     return new drafter_serialize_options{};
@@ -218,6 +459,79 @@ DRAFTER_API void drafter_set_format(drafter_serialize_options* opts, drafter_for
     opts->format = fmt;
 }
 
+DRAFTER_API void drafter_set_parse_stats(drafter_parse_options* opts, drafter_stats* stats)
+{
+    assert(opts);
+    opts->stats = stats;
+}
+
+DRAFTER_API void drafter_set_serialize_stats(drafter_serialize_options* opts, drafter_stats* stats)
+{
+    assert(opts);
+    opts->stats = stats;
+}
+
+DRAFTER_API drafter_stats* drafter_init_stats()
+{
+    return new drafter_stats{};
+}
+
+DRAFTER_API void drafter_free_stats(drafter_stats* stats)
+{
+    delete stats;
+}
+
+DRAFTER_API void drafter_reset_stats(drafter_stats* stats)
+{
+    if (!stats)
+        return;
+
+    *stats = drafter_stats{};
+}
+
+DRAFTER_API void drafter_merge_stats(drafter_stats* into, const drafter_stats* from)
+{
+    if (!into || !from)
+        return;
+
+    for (int i = 0; i < DRAFTER_STAGE_COUNT; ++i) {
+        drafter_stage_stats& to = into->stages[i];
+        const drafter_stage_stats& stage = from->stages[i];
+
+        to.calls += stage.calls;
+        to.milliseconds += stage.milliseconds;
+        to.allocations += stage.allocations;
+        to.allocated_bytes += stage.allocated_bytes;
+        to.elements += stage.elements;
+    }
+}
+
+DRAFTER_API drafter_error drafter_get_stage_stats(
+    const drafter_stats* stats, drafter_stage stage, drafter_stage_stats* out)
+{
+    if (!stats || !out || static_cast<int>(stage) < 0 || stage >= DRAFTER_STAGE_COUNT) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    *out = stats->stages[stage];
+
+    return DRAFTER_OK;
+}
+
+DRAFTER_API const char* drafter_stage_name(drafter_stage stage)
+{
+    static const char* const names[DRAFTER_STAGE_COUNT] = {
+        "markdown", "blueprint", "conversion", "expansion", "body", "schema", "serialization"
+    };
+
+    return static_cast<int>(stage) >= 0 && stage < DRAFTER_STAGE_COUNT ? names[stage] : nullptr;
+}
+
+DRAFTER_API void drafter_count_allocation(size_t size)
+{
+    drafter::CountAllocation(size);
+}
+
 #define VERSION_SHIFT_STEP 8
 
 DRAFTER_API unsigned int drafter_version(void)
@@ -9,6 +9,8 @@
 #ifndef DRAFTER_H
 #define DRAFTER_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -31,6 +33,23 @@ extern "C" {
 #endif
 #endif
 
+/* Concurrency
+ *
+ * All functions are reentrant and may be called from multiple threads at
+ * the same time, as long as no object (parse context, result, options) is
+ * modified by one thread while used by another:
+ * - options may be shared by concurrent parse/serialize calls,
+ * - a result may be serialized by several threads at once, but must not be
+ *   freed meanwhile,
+ * - a parse context must not be used by two threads at the same time.
+ *
+ * The library keeps process-wide state only for caches of immutable data
+ * (compiled regular expressions, looked up without locking once precompiled)
+ * and for the log, which are internally synchronized. The Markdown parser
+ * and its callbacks are set up anew by each parse, other state is thread
+ * local, so no parse context is needed for reentrancy.
+ */
+
 #ifndef __cplusplus
 #include <stdbool.h>
 typedef struct drafter_result drafter_result;
@@ -78,6 +97,20 @@ DRAFTER_API void drafter_set_skip_gen_bodies(drafter_parse_options*);
  */
 DRAFTER_API void drafter_set_skip_gen_body_schemas(drafter_parse_options*);
 
+/* Set lazy_gen_bodies option
+ *   @remark lazy_gen_bodies: message body and schema payloads are generated
+ *           when first serialised, once for each result; results not
+ *           serialised do not pay for them
+ */
+DRAFTER_API void drafter_set_lazy_gen_bodies(drafter_parse_options*);
+
+/* Set conversion_threads option
+ *   @remark conversion_threads: threads converting MSON named types of one
+ *           document, 0 for the number of hardware threads; the result does
+ *           not depend on it
+ */
+DRAFTER_API void drafter_set_conversion_threads(drafter_parse_options*, unsigned int);
+
 /* Serialisation options
  */
 typedef struct drafter_serialize_options drafter_serialize_options;
@@ -110,6 +143,86 @@ typedef enum
     DRAFTER_EINVALID_OUTPUT = -3,
 } drafter_error;
 
+/* Stages of parsing and serialization measured by drafter_stats
+ *   @remark conversion includes expansion and generation of bodies and schemas
+ */
+typedef enum
+{
+    DRAFTER_STAGE_MARKDOWN = 0, /* parsing of Markdown */
+    DRAFTER_STAGE_BLUEPRINT,    /* parsing of API Blueprint sections */
+    DRAFTER_STAGE_CONVERSION,   /* conversion to API Elements */
+    DRAFTER_STAGE_EXPANSION,    /* expansion of MSON data structures */
+    DRAFTER_STAGE_BODY,         /* generation of message bodies */
+    DRAFTER_STAGE_SCHEMA,       /* generation of message body schemas */
+    DRAFTER_STAGE_SERIALIZATION,
+    DRAFTER_STAGE_COUNT
+} drafter_stage;
+
+/* Measurements of a stage, summed over all calls collecting into the same statistics
+ *   @remark elements: Markdown nodes parsed, API Elements converted, expanded, generated
+ *           from or serialized; not counted for DRAFTER_STAGE_BLUEPRINT
+ *   @remark allocations: counted only if the host reports them, see drafter_count_allocation,
+ *           and only those of the thread collecting the statistics; allocations on threads
+ *           converting named types (drafter_set_conversion_threads) are not counted, nor are
+ *           those on other threads of the host, e.g. batch workers, unless collecting into
+ *           statistics of their own
+ */
+typedef struct
+{
+    size_t calls;
+    double milliseconds;
+    size_t allocations;
+    size_t allocated_bytes;
+    size_t elements;
+} drafter_stage_stats;
+
+/* Statistics of parsing and serialization, collected if set to parse or
+ * serialization options; must not be collected by two threads at the same time
+ */
+typedef struct drafter_stats drafter_stats;
+
+/* Allocate statistics, all measurements zero
+ */
+DRAFTER_API drafter_stats* drafter_init_stats();
+
+/* Deallocate statistics
+ */
+DRAFTER_API void drafter_free_stats(drafter_stats*);
+
+/* Set all measurements to zero, nothing if NULL
+ */
+DRAFTER_API void drafter_reset_stats(drafter_stats*);
+
+/* Add measurements of from to into, e.g. to sum statistics collected by several threads
+ *   @remark does nothing if into or from is NULL
+ */
+DRAFTER_API void drafter_merge_stats(drafter_stats* into, const drafter_stats* from);
+
+/* Read measurements of a stage
+ * Returns:
+ * - 0 if everything went smooth.
+ * - DRAFTER_EINVALID_INPUT if stats or out is NULL or stage is unknown.
+ */
+DRAFTER_API drafter_error drafter_get_stage_stats(const drafter_stats*, drafter_stage, drafter_stage_stats* out);
+
+/* Name of a stage, e.g. "markdown", NULL if unknown
+ */
+DRAFTER_API const char* drafter_stage_name(drafter_stage);
+
+/* Collect statistics of parsing with given options into stats, NULL to stop
+ */
+DRAFTER_API void drafter_set_parse_stats(drafter_parse_options*, drafter_stats*);
+
+/* Collect statistics of serialization with given options into stats, NULL to stop
+ */
+DRAFTER_API void drafter_set_serialize_stats(drafter_serialize_options*, drafter_stats*);
+
+/* Report a heap allocation of the calling thread
+ *   @remark to be called by hosts from their allocation functions (operator
+ *           new, malloc hooks) for allocations to be counted by drafter_stats
+ */
+DRAFTER_API void drafter_count_allocation(size_t size);
+
 /* Parse API Blueprint and serialize it to given format.
  * Returns:
  * - 0 if everything went smooth.
@@ -132,9 +245,66 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
 DRAFTER_API drafter_error drafter_parse_blueprint(
     const char* source, drafter_result** out, const drafter_parse_options* parse_opts);
 
+/* Same as drafter_parse_blueprint, parsing size bytes at source, which
+ * need not be NUL-terminated, e.g. a memory-mapped file
+ */
+DRAFTER_API drafter_error drafter_parse_blueprint_buffer(
+    const char* source, size_t size, drafter_result** out, const drafter_parse_options* parse_opts);
+
+/* Parse context
+ *   @remark holds buffers reused by consecutive parses (the copy of the source),
+ *           no other state; parsing is reentrant without a context, see Concurrency
+ */
+typedef struct drafter_parse_context drafter_parse_context;
+
+/* Allocate parse context
+ */
+DRAFTER_API drafter_parse_context* drafter_init_parse_context();
+
+/* Deallocate parse context
+ */
+DRAFTER_API void drafter_free_parse_context(drafter_parse_context*);
+
+/* Same as drafter_parse_blueprint, reusing buffers kept in given context
+ * across calls; intended to be kept per thread by multi-threaded hosts.
+ */
+DRAFTER_API drafter_error drafter_parse_blueprint_with_context(drafter_parse_context* context,
+    const char* source,
+    drafter_result** out,
+    const drafter_parse_options* parse_opts);
+
+/* Same as drafter_parse_blueprint_buffer, reusing buffers kept in given context
+ */
+DRAFTER_API drafter_error drafter_parse_blueprint_buffer_with_context(drafter_parse_context* context,
+    const char* source,
+    size_t size,
+    drafter_result** out,
+    const drafter_parse_options* parse_opts);
+
 /* Serialize result to given format, returns NULL if an error is encountered */
 DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize_options* serialize_opts);
 
+/* Receiver of serialized output
+ *   @param data  chunk of the output, not NUL-terminated
+ *   @param size  size of the chunk in bytes
+ *   @param user  user data as passed to drafter_serialize_to_callback
+ *   @return 0 to continue, non-zero to stop serialization
+ */
+typedef int (*drafter_write_callback)(const char* data, size_t size, void* user);
+
+/* Serialize result to given format, streaming the output in chunks to
+ * given callback instead of building it in memory.
+ *
+ * Returns:
+ * - 0 if everything went smooth.
+ * - DRAFTER_EINVALID_INPUT if result or callback is NULL or format is unknown.
+ * - DRAFTER_EINVALID_OUTPUT if the callback requested to stop serialization.
+ */
+DRAFTER_API drafter_error drafter_serialize_to_callback(drafter_result* res,
+    const drafter_serialize_options* serialize_opts,
+    drafter_write_callback callback,
+    void* user);
+
 /* Free memory allocated for result handler */
 DRAFTER_API void drafter_free_result(drafter_result* res);
 
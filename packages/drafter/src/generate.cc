@@ -0,0 +1,125 @@
+//
+//  generate.cc
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+//  drafter-generate - writes synthetic API Blueprints for scale testing
+//
+
+#include "BlueprintGenerator.h"
+#include "cmdline.h"
+#include "stream.h"
+
+#include <cstdlib>
+#include <memory>
+
+namespace config
+{
+    static const std::string Program = "drafter-generate";
+
+    static const std::string Output = "output";
+    static const std::string Groups = "groups";
+    static const std::string Resources = "resources";
+    static const std::string Actions = "actions";
+    static const std::string Types = "types";
+    static const std::string Depth = "depth";
+    static const std::string OneOf = "one-of";
+    static const std::string Mixins = "mixins";
+    static const std::string Properties = "properties";
+    static const std::string Size = "size";
+    static const std::string Seed = "seed";
+    static const std::string Help = "help";
+};
+
+namespace
+{
+    void PrepareCommandLineParser(cmdline::parser& parser, const drafter::BlueprintShape& defaults)
+    {
+        const int Max = 1 << 24;
+
+        parser.set_program_name(config::Program);
+
+        parser.add<std::string>(config::Output, 'o', "save the blueprint into file", false);
+        parser.add<int>(config::Groups,
+            'g',
+            "number of resource groups",
+            false,
+            defaults.resourceGroups,
+            cmdline::range(0, Max));
+        parser.add<int>(config::Resources,
+            'r',
+            "number of resources in each group",
+            false,
+            defaults.resources,
+            cmdline::range(0, Max));
+        parser.add<int>(
+            config::Actions, 'a', "number of actions of each resource", false, defaults.actions, cmdline::range(0, 5));
+        parser.add<int>(
+            config::Types, 't', "number of MSON named types", false, defaults.namedTypes, cmdline::range(0, Max));
+        parser.add<int>(config::Depth,
+            'd',
+            "inheritance depth of named types",
+            false,
+            defaults.inheritanceDepth,
+            cmdline::range(0, Max));
+        parser.add<int>(config::OneOf,
+            'n',
+            "number of `One Of` options of each named type",
+            false,
+            defaults.oneOfFanOut,
+            cmdline::range(0, Max));
+        parser.add<int>(
+            config::Mixins, 'm', "number of mixins of each named type", false, defaults.mixins, cmdline::range(0, Max));
+        parser.add<int>(config::Properties,
+            'p',
+            "number of properties of each named type",
+            false,
+            defaults.properties,
+            cmdline::range(0, Max));
+        parser.add<int>(config::Size,
+            's',
+            "minimal size of the blueprint in KiB, reached by adding resource groups",
+            false,
+            0,
+            cmdline::range(0, Max));
+        parser.add<int>(config::Seed, 'S', "seed of the pseudo-random choices", false, defaults.seed);
+        parser.add(config::Help, 'h', "display this help message");
+
+        std::stringstream ss;
+
+        ss << "\n\n";
+        ss << "Synthetic API Blueprint Generator\n";
+        ss << "Equal options generate equal blueprints. If called without --output, the blueprint is written to stdout.";
+
+        parser.footer(ss.str());
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    drafter::BlueprintShape shape;
+
+    cmdline::parser parser;
+    PrepareCommandLineParser(parser, shape);
+
+    parser.parse_check(argc, argv);
+
+    shape.resourceGroups = parser.get<int>(config::Groups);
+    shape.resources = parser.get<int>(config::Resources);
+    shape.actions = parser.get<int>(config::Actions);
+    shape.namedTypes = parser.get<int>(config::Types);
+    shape.inheritanceDepth = parser.get<int>(config::Depth);
+    shape.oneOfFanOut = parser.get<int>(config::OneOf);
+    shape.mixins = parser.get<int>(config::Mixins);
+    shape.properties = parser.get<int>(config::Properties);
+    shape.size = static_cast<std::size_t>(parser.get<int>(config::Size)) * 1024;
+    shape.seed = static_cast<std::uint32_t>(parser.get<int>(config::Seed));
+
+    std::unique_ptr<std::ostream> out(CreateStreamFromName<std::ostream>(parser.get<std::string>(config::Output)));
+
+    drafter::GenerateBlueprint(*out, shape);
+    out->flush();
+
+    return *out ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,85 @@
+//
+//  input.cc
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "input.h"
+
+#include <fstream>
+#include <iostream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#if !defined(_WIN32)
+    /** \return Mapping of given regular file, nullptr if it cannot be mapped */
+    void* MapFile(const std::string& file, std::size_t& size)
+    {
+        const int fd = ::open(file.c_str(), O_RDONLY);
+        if (fd < 0)
+            return nullptr;
+
+        void* mapping = nullptr;
+        struct stat info;
+
+        // empty files cannot be mapped, they are read like any other input
+        if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+            mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+            } else {
+                size = static_cast<std::size_t>(info.st_size);
+                ::madvise(mapping, size, MADV_SEQUENTIAL);
+            }
+        }
+
+        ::close(fd);
+        return mapping;
+    }
+#endif
+}
+
+Input::Input(const std::string& file) : buffer_(), mapping_(nullptr), size_(0), good_(true)
+{
+#if !defined(_WIN32)
+    if (!file.empty() && (mapping_ = MapFile(file, size_)))
+        return;
+#endif
+
+    std::ifstream fileStream;
+
+    if (!file.empty()) {
+        fileStream.open(file.c_str(), std::ios_base::binary);
+
+        if (!fileStream.is_open()) {
+            good_ = false;
+            return;
+        }
+    }
+
+    std::istream& in = file.empty() ? std::cin : fileStream;
+
+    char chunk[1 << 16];
+    while (in.read(chunk, sizeof(chunk)) || in.gcount() > 0)
+        buffer_.append(chunk, static_cast<std::size_t>(in.gcount()));
+
+    size_ = buffer_.size();
+    good_ = !in.bad();
+}
+
+Input::~Input()
+{
+#if !defined(_WIN32)
+    if (mapping_)
+        ::munmap(mapping_, size_);
+#endif
+}
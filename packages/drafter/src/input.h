@@ -0,0 +1,58 @@
+//
+//  input.h
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_INPUT_H
+#define DRAFTER_INPUT_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ *  \brief Content of the input of the command line tool
+ *
+ *  Regular files are memory-mapped where supported, so the content is not
+ *  copied to the heap; other inputs (stdin, pipes) are read into memory.
+ */
+class Input
+{
+    std::string buffer_;
+    void* mapping_;
+    std::size_t size_;
+    bool good_;
+
+public:
+    /**
+     *  \brief Read the file of given name, standard input if empty
+     *
+     *  Check good() for whether the file could be read.
+     */
+    explicit Input(const std::string& file);
+    ~Input();
+
+    Input(const Input&) = delete;
+    Input& operator=(const Input&) = delete;
+
+    /** \return Content of the input, not NUL-terminated */
+    const char* data() const noexcept
+    {
+        return mapping_ ? static_cast<const char*>(mapping_) : buffer_.data();
+    }
+
+    /** \return Size of the content in bytes */
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /** \return Whether the input could be read */
+    bool good() const noexcept
+    {
+        return good_;
+    }
+};
+
+#endif // #ifndef DRAFTER_INPUT_H
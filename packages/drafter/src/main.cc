@@ -14,56 +14,136 @@
 #include "SerializeResult.h"
 
 #include "reporting.h"
+#include "batch.h"
 #include "config.h"
+#include "input.h"
 #include "stream.h"
 
 #include "ConversionContext.h"
 
 #include "utils/log/Trivial.h"
 
+#include <cstdlib>
+#include <new>
+
 namespace sc = snowcrash;
 
-int ProcessRefract(const Config& config, std::unique_ptr<std::istream>& in, std::unique_ptr<std::ostream>& out)
+// set by `--stats` before any thread is started, allocations are reported otherwise not
+static bool CountAllocations = false;
+
+// report allocations to the library, so `--stats` can account them to stages
+void* operator new(std::size_t size)
+{
+    if (CountAllocations)
+        drafter_count_allocation(size);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    if (CountAllocations)
+        drafter_count_allocation(size);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return ::operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    int WriteToStream(const char* data, size_t size, void* user)
+    {
+        std::ostream& out = *static_cast<std::ostream*>(user);
+        out.write(data, size);
+        return out ? 0 : 1;
+    }
+}
+
+int ProcessRefract(const Config& config, const Input& in, std::unique_ptr<std::ostream>& out)
 {
     if (config.enableLog)
         ENABLE_LOGGING;
 
-    std::stringstream inputStream;
-    inputStream << in->rdbuf();
+    drafter_stats* stats = config.stats ? drafter_init_stats() : nullptr;
 
     drafter_serialize_options* options = drafter_init_serialize_options();
     if (config.sourceMap)
         drafter_set_sourcemaps_included(options);
     if (config.format == drafter::JSONFormat)
         drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+    drafter_set_serialize_stats(options, stats);
 
     refract::IElement* result = nullptr;
 
-    // TODO: Read parse options from CLI
     drafter_parse_options* parseOptions = drafter_init_parse_options();
-    int ret = drafter_parse_blueprint(inputStream.str().c_str(), &result, parseOptions);
+    drafter_set_parse_stats(parseOptions, stats);
+    if (config.validate) // nothing is serialised, so bodies are never generated
+        drafter_set_lazy_gen_bodies(parseOptions);
+    int ret = drafter_parse_blueprint_buffer(in.data(), in.size(), &result, parseOptions);
     drafter_free_parse_options(parseOptions);
 
     if (!result) {
+        drafter_free_serialize_options(options);
+        drafter_free_stats(stats);
         return -1;
     }
 
     if (!config.validate) { // If not validate, we serialize
-        char* output = drafter_serialize(result, options);
-
-        if (output) {
-            *out << output << "\n" << std::flush;
-
-            free(output);
+        if (drafter_serialize_to_callback(result, options, WriteToStream, out.get()) == DRAFTER_OK) {
+            *out << "\n" << std::flush;
         }
     }
 
     drafter_free_serialize_options(options);
 
-    PrintReport(result, inputStream.str(), config.lineNumbers, ret);
+    PrintReport(result, in.data(), in.size(), config.lineNumbers, ret);
 
     drafter_free_result(result);
 
+    if (stats) {
+        PrintStats(stats, std::cerr);
+        drafter_free_stats(stats);
+    }
+
     return ret;
 }
 
@@ -72,7 +152,18 @@ int main(int argc, const char* argv[])
     Config config;
     ParseCommadLineOptions(argc, argv, config);
 
-    std::unique_ptr<std::istream> in(CreateStreamFromName<std::istream>(config.input));
+    CountAllocations = config.stats;
+
+    if (!config.batch.empty())
+        return ProcessBatch(config);
+
+    Input in(config.input);
+
+    if (!in.good()) {
+        std::cerr << "fatal: unable to open file '" << config.input << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
     std::unique_ptr<std::ostream> out(CreateStreamFromName<std::ostream>(config.output));
 
     return ProcessRefract(config, in, out);
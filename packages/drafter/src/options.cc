@@ -31,3 +31,23 @@ bool drafter::is_skip_gen_body_schemas(const drafter_parse_options* opts) noexce
 {
     return opts && opts->flags.test(drafter_parse_options::SKIP_GEN_BODY_SCHEMAS);
 }
+
+bool drafter::is_lazy_gen_bodies(const drafter_parse_options* opts) noexcept
+{
+    return opts && opts->flags.test(drafter_parse_options::LAZY_GEN_BODIES);
+}
+
+unsigned int drafter::get_conversion_threads(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->conversion_threads : 1;
+}
+
+drafter_stats* drafter::get_stats(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->stats : nullptr;
+}
+
+drafter_stats* drafter::get_stats(const drafter_serialize_options* opts) noexcept
+{
+    return opts ? opts->stats : nullptr;
+}
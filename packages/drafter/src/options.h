@@ -14,13 +14,16 @@
 #include <bitset>
 
 struct drafter_parse_options {
-    using flags_type = std::bitset<3>;
+    using flags_type = std::bitset<4>;
 
     static constexpr std::size_t NAME_REQUIRED = 0;
     static constexpr std::size_t SKIP_GEN_BODIES = 1;
     static constexpr std::size_t SKIP_GEN_BODY_SCHEMAS = 2;
+    static constexpr std::size_t LAZY_GEN_BODIES = 3;
 
     flags_type flags = 0;
+    drafter_stats* stats = nullptr;
+    unsigned int conversion_threads = 1;
 };
 
 struct drafter_serialize_options {
@@ -30,6 +33,7 @@ struct drafter_serialize_options {
 
     flags_type flags = 0;
     drafter_format format = DRAFTER_SERIALIZE_YAML;
+    drafter_stats* stats = nullptr;
 };
 
 namespace drafter
@@ -54,10 +58,30 @@ namespace drafter
      */
     bool is_skip_gen_body_schemas(const drafter_parse_options*) noexcept;
 
+    /* Access lazy_gen_bodies option
+     *   @remark lazy_gen_bodies: generate message bodies and schemas on first serialisation
+     */
+    bool is_lazy_gen_bodies(const drafter_parse_options*) noexcept;
+
+    /* Access conversion_threads option
+     *   @remark conversion_threads: threads converting named types, at least 1
+     */
+    unsigned int get_conversion_threads(const drafter_parse_options*) noexcept;
+
     /* Access format option
      *   @remark format: API Elements serialisation format (YAML|JSON)
      */
     drafter_format get_format(const drafter_serialize_options*) noexcept;
+
+    /* Access stats option
+     *   @remark stats: statistics collected while parsing, or NULL
+     */
+    drafter_stats* get_stats(const drafter_parse_options*) noexcept;
+
+    /* Access stats option
+     *   @remark stats: statistics collected while serializing, or NULL
+     */
+    drafter_stats* get_stats(const drafter_serialize_options*) noexcept;
 }
 
 #endif
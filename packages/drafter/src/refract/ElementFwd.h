@@ -26,6 +26,7 @@ namespace refract
         class Extend;
         class Option;
         class Select;
+        class SourceMap;
     }
 
     template <typename>
@@ -48,6 +49,8 @@ namespace refract
 
     using OptionElement = Element<dsd::Option>;
     using SelectElement = Element<dsd::Select>;
+
+    using SourceMapElement = Element<dsd::SourceMap>;
 }
 
 #endif
@@ -12,6 +12,8 @@
 #include <string>
 #include <memory>
 
+#include "Symbol.h"
+
 namespace refract
 {
     class InfoElements;
@@ -69,7 +71,7 @@ namespace refract
         ///
         /// @return Element name
         ///
-        virtual std::string element() const = 0;
+        virtual const Symbol& element() const noexcept = 0;
 
         ///
         /// Set name of this Element
@@ -21,7 +21,7 @@ namespace
 {
     const ArrayElement* enumerations(const EnumElement& e)
     {
-        auto it = e.attributes().find("enumerations");
+        auto it = e.attributes().find(symbols::enumerations);
         if (it != e.attributes().end())
             if (const ArrayElement* enums = get<const ArrayElement>(it->second.get()))
                 return enums;
@@ -185,3 +185,8 @@ cardinal refract::sizeOf(const OptionElement& e, bool inheritsFixed)
         return cardinal::empty();
     return sizeOfMult(e.get().begin(), e.get().end(), inheritsFixed);
 }
+
+cardinal refract::sizeOf(const SourceMapElement& e, bool inheritsFixed)
+{
+    return cardinal::empty();
+}
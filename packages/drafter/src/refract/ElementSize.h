@@ -27,6 +27,7 @@ namespace refract
     cardinal sizeOf(const OptionElement& e, bool inheritsFixed = false);
     cardinal sizeOf(const RefElement& e, bool inheritsFixed = false);
     cardinal sizeOf(const SelectElement& e, bool inheritsFixed = false);
+    cardinal sizeOf(const SourceMapElement& e, bool inheritsFixed = false);
     cardinal sizeOf(const StringElement& e, bool inheritsFixed = false);
 
     cardinal sizeOf(const IElement& e, bool inheritsFixed = false);
@@ -100,7 +100,7 @@ bool refract::inheritsFixed(const ExtendElement& e)
 
 bool refract::hasTypeAttr(const IElement& e, const char* name)
 {
-    auto typeAttrIt = e.attributes().find("typeAttributes");
+    auto typeAttrIt = e.attributes().find(symbols::typeAttributes);
 
     if (typeAttrIt != e.attributes().end())
         if (const auto* typeAttrs = get<const ArrayElement>(typeAttrIt->second.get())) {
@@ -141,7 +141,7 @@ bool refract::hasNullableTypeAttr(const IElement& e)
 
 bool refract::isVariable(const IElement& e)
 {
-    const auto it = e.attributes().find("variable");
+    const auto it = e.attributes().find(symbols::variable);
     if (it == e.attributes().end())
         return false;
 
@@ -200,9 +200,9 @@ void refract::setFixedTypeAttribute(IElement& e)
 
 void refract::setTypeAttribute(IElement& e, const std::string& typeAttribute)
 {
-    auto typeAttrIt = e.attributes().find("typeAttributes");
+    auto typeAttrIt = e.attributes().find(symbols::typeAttributes);
     if (e.attributes().end() == typeAttrIt) {
-        e.attributes().set("typeAttributes", make_element<ArrayElement>(from_primitive(typeAttribute)));
+        e.attributes().set(symbols::typeAttributes, make_element<ArrayElement>(from_primitive(typeAttribute)));
     } else {
         if (auto* typeAttrs = get<ArrayElement>(typeAttrIt->second.get())) {
             const auto b = typeAttrs->get().begin();
@@ -219,22 +219,22 @@ void refract::setTypeAttribute(IElement& e, const std::string& typeAttribute)
 
 void refract::setDefault(IElement& e, std::unique_ptr<IElement> deflt)
 {
-    e.attributes().set("default", std::move(deflt));
+    e.attributes().set(symbols::default_, std::move(deflt));
 }
 
 void refract::addSample(IElement& e, std::unique_ptr<IElement> sample)
 {
-    auto it = e.attributes().find("samples");
+    auto it = e.attributes().find(symbols::samples);
     if (it == e.attributes().end()) {
         LOG(info) << "creating new samples entry";
-        e.attributes().set("samples", make_element<ArrayElement>(std::move(sample)));
+        e.attributes().set(symbols::samples, make_element<ArrayElement>(std::move(sample)));
     } else if (ArrayElement* samples = get<ArrayElement>(it->second.get())) {
         if (samples->empty()) {
             LOG(error) << "empty Array Element in samples";
             assert(false);
         }
         LOG(info) << "adding new sample";
-        e.attributes().set("samples", make_element<ArrayElement>(std::move(sample)));
+        e.attributes().set(symbols::samples, make_element<ArrayElement>(std::move(sample)));
         samples->get().push_back(std::move(sample));
     } else {
         LOG(error) << "expected samples to be held in Array Element content";
@@ -244,9 +244,9 @@ void refract::addSample(IElement& e, std::unique_ptr<IElement> sample)
 
 void refract::addEnumeration(IElement& e, std::unique_ptr<IElement> enm)
 {
-    auto it = e.attributes().find("enumerations");
+    auto it = e.attributes().find(symbols::enumerations);
     if (it == e.attributes().end())
-        e.attributes().set("enumerations", make_element<ArrayElement>(std::move(enm)));
+        e.attributes().set(symbols::enumerations, make_element<ArrayElement>(std::move(enm)));
     else if (ArrayElement* enums = get<ArrayElement>(it->second.get())) {
         if (enums->empty()) {
             LOG(error) << "empty Array Element in enumerations";
@@ -261,7 +261,7 @@ void refract::addEnumeration(IElement& e, std::unique_ptr<IElement> enm)
 
 const IElement* refract::findFirstSample(const IElement& e)
 {
-    auto it = e.attributes().find("samples");
+    auto it = e.attributes().find(symbols::samples);
     if (it != e.attributes().end()) {
         if (const auto& samples = get<const ArrayElement>(it->second.get()))
             if (!samples->empty() && !samples->get().empty())
@@ -272,7 +272,7 @@ const IElement* refract::findFirstSample(const IElement& e)
 
 const IElement* refract::findDefault(const IElement& e)
 {
-    auto it = e.attributes().find("default");
+    auto it = e.attributes().find(symbols::default_);
     if (it != e.attributes().end())
         return it->second.get();
     return nullptr;
@@ -296,7 +296,7 @@ bool refract::definesValue(const IElement& e)
 
 const IElement* refract::resolve(const RefElement& element)
 {
-    const auto resolvedEntry = element.attributes().find("resolved");
+    const auto resolvedEntry = element.attributes().find(symbols::resolved);
     if (resolvedEntry == element.attributes().end()) {
         LOG(error) << "expected all references to be resolved in backend";
         assert(false);
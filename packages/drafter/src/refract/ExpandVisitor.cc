@@ -42,18 +42,18 @@ namespace refract
 
         void CopyMetaId(IElement& dst, const IElement& src)
         {
-            auto name = src.meta().find("id");
+            auto name = src.meta().find(symbols::id);
             if (name != src.meta().end() && name->second && !name->second->empty()) {
-                dst.meta().set("id", name->second->clone());
+                dst.meta().set(symbols::id, name->second->clone());
             }
         }
 
         void MetaIdToRef(IElement& e)
         {
-            auto name = e.meta().find("id");
+            auto name = e.meta().find(symbols::id);
             if (name != e.meta().end() && name->second && !name->second->empty()) {
-                e.meta().set("ref", name->second->clone());
-                e.meta().erase("id");
+                e.meta().set(symbols::ref, name->second->clone());
+                e.meta().erase(symbols::id);
             }
         }
 
@@ -129,7 +129,7 @@ namespace refract
 
                 inheritance.emplace_back(
                     en, clone(*parent, ((IElement::cAll ^ IElement::cElement) | IElement::cNoMetaId)));
-                inheritance.back().second->meta().set("ref", from_primitive(en));
+                inheritance.back().second->meta().set(symbols::ref, from_primitive(en));
             }
 
             if (inheritance.empty())
@@ -158,9 +158,20 @@ namespace refract
 
         const Registry& registry;
         ExpandVisitor* expand;
+        ExpandedTypes* cache;
         std::deque<std::string> members;
 
-        Context(const Registry& registry, ExpandVisitor* expand) : registry(registry), expand(expand) {}
+        Context(const Registry& registry, ExpandVisitor* expand, ExpandedTypes* cache)
+            : registry(registry), expand(expand), cache(cache)
+        {
+        }
+
+        // expansion depends on the named types being expanded at the moment,
+        // so only results of outermost expansions are memoized
+        bool Memoizable() const noexcept
+        {
+            return cache && members.empty();
+        }
 
         std::unique_ptr<IElement> ExpandOrClone(const IElement* e) const
         {
@@ -199,6 +210,28 @@ namespace refract
             return o;
         }
 
+        std::unique_ptr<ExtendElement> ExpandAncestors(const std::string& name)
+        {
+            const bool memoize = Memoizable();
+
+            if (memoize) {
+                auto cached = cache->ancestors.find(name);
+                if (cached != cache->ancestors.end()) {
+                    return clone(static_cast<const ExtendElement&>(*cached->second));
+                }
+            }
+
+            members.push_back(name);
+            auto extend = ExpandMembers(*GetInheritanceTree(name, registry));
+            members.pop_back();
+
+            if (memoize) {
+                cache->ancestors[name] = clone(*extend);
+            }
+
+            return extend;
+        }
+
         template <typename T>
         std::unique_ptr<IElement> ExpandNamedType(const T& e)
         {
@@ -213,21 +246,17 @@ namespace refract
 
                 auto result = clone(*root, IElement::cMeta | IElement::cAttributes | IElement::cNoMetaId);
 
-                result->meta().set("ref", from_primitive(e.element()));
+                result->meta().set(symbols::ref, from_primitive(e.element().str()));
 
                 return result;
             }
 
-            members.push_back(e.element());
-
-            auto extend = ExpandMembers(*GetInheritanceTree(e.element(), registry));
+            auto extend = ExpandAncestors(e.element());
 
             CopyMetaId(*extend, e);
 
-            members.pop_back();
-
             auto origin = ExpandMembers(e);
-            origin->meta().erase("id");
+            origin->meta().erase(symbols::id);
 
             if (extend->empty())
                 extend->set();
@@ -255,12 +284,27 @@ namespace refract
                 throw snowcrash::Error(msg.str(), snowcrash::MSONError);
             }
 
+            const bool memoize = Memoizable();
+
+            if (memoize) {
+                auto cached = cache->references.find(symbol);
+                if (cached != cache->references.end()) {
+                    ref->attributes().set(symbols::resolved, cached->second->clone());
+                    return ref;
+                }
+            }
+
             members.push_back(symbol);
 
             if (auto referenced = registry.find(symbol)) {
                 auto expanded = ExpandOrClone(std::move(referenced));
                 MetaIdToRef(*expanded);
-                ref->attributes().set("resolved", std::move(expanded));
+
+                if (memoize) {
+                    cache->references[symbol] = expanded->clone();
+                }
+
+                ref->attributes().set(symbols::resolved, std::move(expanded));
             }
 
             members.pop_back();
@@ -302,7 +346,7 @@ namespace refract
             o->meta() = e.meta();
 
             for (const auto& attribute : e.attributes()) {
-                if (attribute.first == "enumerations") {
+                if (attribute.first == symbols::enumerations) {
                     const auto* enums = TypeQueryVisitor::as<const ArrayElement>(attribute.second.get());
                     assert(enums);
                     assert(!enums->empty());
@@ -312,7 +356,7 @@ namespace refract
                         assert(entry);
                         expanded.push_back(context->ExpandOrClone(entry.get()));
                     }
-                    o->attributes().set("enumerations", make_element<ArrayElement>(std::move(expanded)));
+                    o->attributes().set(symbols::enumerations, make_element<ArrayElement>(std::move(expanded)));
                 } else {
                     o->attributes().set(attribute.first, attribute.second->clone());
                 }
@@ -388,7 +432,14 @@ namespace refract
         return ExpandElement<T>()(e, context);
     }
 
-    ExpandVisitor::ExpandVisitor(const Registry& registry) : result(nullptr), context(new Context(registry, this)){};
+    void ExpandedTypes::clear()
+    {
+        ancestors.clear();
+        references.clear();
+    }
+
+    ExpandVisitor::ExpandVisitor(const Registry& registry, ExpandedTypes* cache)
+        : result(nullptr), context(new Context(registry, this, cache)){};
 
     ExpandVisitor::~ExpandVisitor()
     {
@@ -406,6 +457,9 @@ namespace refract
     // do nothing, NullElements are not expandable
     void ExpandVisitor::operator()(const NullElement& e) {}
 
+    // do nothing, SourceMapElements are not expandable
+    void ExpandVisitor::operator()(const SourceMapElement& e) {}
+
     VISIT_IMPL(String)
     VISIT_IMPL(Number)
     VISIT_IMPL(Boolean)
@@ -11,20 +11,33 @@
 
 #include "ElementFwd.h"
 #include "ElementIfc.h"
+#include <map>
 #include <memory>
+#include <string>
 
 namespace refract
 {
 
     class Registry;
 
+    // Named types already expanded by ExpandVisitor, keyed by type name.
+    // Valid only as long as the Registry they were expanded from is not modified.
+    struct ExpandedTypes {
+        using type_map = std::map<std::string, std::unique_ptr<IElement> >;
+
+        type_map ancestors;  // expanded inheritance trees of named types
+        type_map references; // expanded types resolved by references
+
+        void clear();
+    };
+
     class ExpandVisitor
     {
 
     public:
         struct Context;
 
-        ExpandVisitor(const Registry& registry);
+        ExpandVisitor(const Registry& registry, ExpandedTypes* cache = nullptr);
         ~ExpandVisitor();
 
         void operator()(const IElement& e);
@@ -48,6 +61,8 @@ namespace refract
         void operator()(const OptionElement& e);
         void operator()(const SelectElement& e);
 
+        void operator()(const SourceMapElement& e);
+
         // return expanded elemnt or NULL if expansion is not needed
         // caller responsibility is to delete returned Element
         std::unique_ptr<IElement> get();
@@ -1,5 +1,5 @@
 //
-//  refract/dsd/InfoElements.h
+//  refract/InfoElements.cc
 //  librefract
 //
 //  Created by Thomas Jandecka on 21/08/2017
@@ -18,6 +18,8 @@ namespace refract
 {
     InfoElements::InfoElements() : elements() {}
 
+    InfoElements::InfoElements(const InfoElements& other) : elements(other.elements) {}
+
     InfoElements::InfoElements(InfoElements&& other) : InfoElements()
     {
         swap(*this, other);
@@ -29,119 +31,194 @@ namespace refract
         return *this;
     }
 
+    InfoElements::Container& InfoElements::none() noexcept
+    {
+        static Container empty; // never modified
+        return empty;
+    }
+
+    InfoElements::Container& InfoElements::mutate()
+    {
+        if (!elements) {
+            elements = std::make_shared<Container>();
+        } else if (elements.use_count() > 1) {
+            auto copy = std::make_shared<Container>();
+            copy->reserve(elements->size());
+            std::transform(
+                elements->begin(), elements->end(), std::back_inserter(*copy), [](const InfoElements::value_type& el) {
+                    assert(el.second);
+                    return std::make_pair(el.first, refract::clone(*el.second));
+                });
+            elements = std::move(copy);
+        }
+
+        return *elements;
+    }
+
     InfoElements::const_iterator InfoElements::begin() const noexcept
     {
-        return elements.begin();
+        return elements ? elements->cbegin() : none().cbegin();
     }
 
-    InfoElements::iterator InfoElements::begin() noexcept
+    InfoElements::iterator InfoElements::begin()
     {
-        return elements.begin();
+        return elements ? mutate().begin() : none().begin();
     }
 
     InfoElements::const_iterator InfoElements::end() const noexcept
     {
-        return elements.end();
+        return elements ? elements->cend() : none().cend();
     }
 
-    InfoElements::iterator InfoElements::end() noexcept
+    InfoElements::iterator InfoElements::end()
     {
-        return elements.end();
+        return elements ? mutate().end() : none().end();
     }
 
     void InfoElements::erase(iterator it)
     {
-        elements.erase(it);
+        it = own(it);
+        elements->erase(it);
     }
 
     void InfoElements::clear()
     {
-        elements.clear();
+        elements.reset();
     }
 
     bool InfoElements::empty() const noexcept
     {
-        return elements.empty();
+        return !elements || elements->empty();
     }
 
     InfoElements::Container::size_type InfoElements::size() const noexcept
     {
-        return elements.size();
+        return elements ? elements->size() : 0;
     }
 
-    InfoElements::InfoElements(const InfoElements& other) : elements()
+    void InfoElements::clone(const InfoElements& other)
     {
-        elements.reserve(other.size());
+        if (empty()) {
+            elements = other.elements;
+            return;
+        }
+
+        if (other.empty())
+            return;
+
+        auto& target = mutate();
         std::transform(
-            other.begin(), other.end(), std::back_inserter(elements), [](const InfoElements::value_type& el) {
+            other.begin(), other.end(), std::back_inserter(target), [](const InfoElements::value_type& el) {
                 assert(el.second);
                 return std::make_pair(el.first, refract::clone(*el.second));
             });
     }
 
-    void InfoElements::clone(const InfoElements& other)
+    namespace
     {
-        std::transform(
-            other.begin(), other.end(), std::back_inserter(elements), [](const InfoElements::value_type& el) {
-                assert(el.second);
-                return std::make_pair(el.first, refract::clone(*el.second));
-            });
+        template <typename It, typename Key>
+        It find_key(It first, It last, const Key& key)
+        {
+            return std::find_if(
+                first, last, [&key](const InfoElements::value_type& keyValue) { return keyValue.first == key; });
+        }
+
+        template <typename Container, typename Key>
+        void erase_key(Container& elements, const Key& key)
+        {
+            elements.erase(std::remove_if(elements.begin(),
+                               elements.end(),
+                               [&key](const InfoElements::value_type& keyValue) { return keyValue.first == key; }),
+                elements.end());
+        }
+    }
+
+    InfoElements::iterator InfoElements::own(iterator it)
+    {
+        // `it` may point into entries shared with copies, which keep them alive
+        const Symbol key = it->first;
+        auto& target = mutate();
+
+        it = find_key(target.begin(), target.end(), key);
+        assert(it != target.end());
+
+        return it;
     }
 
     void InfoElements::erase(const std::string& key)
     {
-        elements.erase(std::remove_if(elements.begin(),
-                           elements.end(),
-                           [&key](const InfoElements::value_type& keyValue) { return keyValue.first == key; }),
-            elements.end());
+        const InfoElements& self = *this;
+        if (self.find(key) != self.end())
+            erase_key(mutate(), key);
+    }
+
+    void InfoElements::erase(const Symbol& key)
+    {
+        const InfoElements& self = *this;
+        if (self.find(key) != self.end())
+            erase_key(mutate(), key);
     }
 
     IElement& InfoElements::set(const std::string& key, std::unique_ptr<IElement> value)
+    {
+        return set(Symbol(key), std::move(value));
+    }
+
+    IElement& InfoElements::set(const std::string& key, const IElement& value)
+    {
+        return set(Symbol(key), refract::clone(value));
+    }
+
+    IElement& InfoElements::set(const Symbol& key, std::unique_ptr<IElement> value)
     {
         auto& valueRef = *value;
+        auto& target = mutate();
 
-        auto it = find(key);
-        if (it == end())
-            elements.emplace_back(key, std::move(value));
+        auto it = find_key(target.begin(), target.end(), key);
+        if (it == target.end())
+            target.emplace_back(key, std::move(value));
         else
             it->second = std::move(value);
 
         return valueRef;
     }
 
-    IElement& InfoElements::set(const std::string& key, const IElement& value)
-    {
-        return set(key, refract::clone(value));
-    }
-
     std::unique_ptr<IElement> InfoElements::claim(const std::string& key)
     {
-        auto member = find(key);
-        if (member != elements.end()) {
-            return claim(member);
-        }
-        return nullptr;
+        const InfoElements& self = *this;
+        if (self.find(key) == self.end())
+            return nullptr;
+
+        return claim(find(key));
     }
 
     std::unique_ptr<IElement> InfoElements::claim(iterator it)
     {
-        std::unique_ptr<IElement> result(it->second.release());
-        elements.erase(it);
+        it = own(it);
+
+        std::unique_ptr<IElement> result(std::move(it->second));
+        elements->erase(it);
 
         return result;
     }
 
     InfoElements::const_iterator InfoElements::find(const std::string& name) const
     {
-        return std::find_if(elements.begin(), elements.end(), [&name](const InfoElements::value_type& keyValue) {
-            return keyValue.first == name;
-        });
+        return find_key(begin(), end(), name);
     }
 
     InfoElements::iterator InfoElements::find(const std::string& name)
     {
-        return std::find_if(elements.begin(), elements.end(), [&name](const InfoElements::value_type& keyValue) {
-            return keyValue.first == name;
-        });
+        return find_key(begin(), end(), name);
+    }
+
+    InfoElements::const_iterator InfoElements::find(const Symbol& name) const
+    {
+        return find_key(begin(), end(), name);
+    }
+
+    InfoElements::iterator InfoElements::find(const Symbol& name)
+    {
+        return find_key(begin(), end(), name);
     }
 }
@@ -14,13 +14,32 @@
 #include <vector>
 
 #include "ElementIfc.h"
+#include "Symbol.h"
 
 namespace refract
 {
+    ///
+    /// Meta or attributes of a Refract Element
+    ///
+    /// Copies share their entries until either of them is accessed for
+    /// modification; copying Elements thus does not deep-copy their meta and
+    /// attributes (e.g. source maps) unless they are modified afterwards.
+    ///
+    /// @remark iterators and references obtained by non-const access must not
+    ///         be used to modify entries once the InfoElements was copied
+    ///
     class InfoElements final
     {
-        using Container = std::vector<std::pair<std::string, std::unique_ptr<IElement> > >;
-        Container elements;
+        using Container = std::vector<std::pair<Symbol, std::unique_ptr<IElement> > >;
+        std::shared_ptr<Container> elements; //< shared by copies, null if empty
+
+        /// Entries owned exclusively by `this`, deep-copied if shared
+        Container& mutate();
+
+        /// Entry of `it` among entries owned exclusively by `this`
+        Container::iterator own(Container::iterator it);
+
+        static Container& none() noexcept;
 
     public:
         using iterator = typename Container::iterator;
@@ -46,22 +65,27 @@ namespace refract
     public:
         const_iterator begin() const noexcept;
 
-        iterator begin() noexcept;
+        iterator begin();
 
         const_iterator end() const noexcept;
 
-        iterator end() noexcept;
+        iterator end();
 
         const_iterator find(const std::string& name) const;
         iterator find(const std::string& name);
 
+        const_iterator find(const Symbol& name) const;
+        iterator find(const Symbol& name);
+
         IElement& set(const std::string& key, std::unique_ptr<IElement> value);
         IElement& set(const std::string& key, const IElement& value);
+        IElement& set(const Symbol& key, std::unique_ptr<IElement> value);
 
         /// clone elements from `other` to `this`
         void clone(const InfoElements& other);
 
         void erase(const std::string& key);
+        void erase(const Symbol& key);
         void erase(iterator it);
 
         std::unique_ptr<IElement> claim(const std::string& key);
@@ -126,6 +126,14 @@ namespace refract
             }
         };
 
+        template <>
+        struct IsExpandable<SourceMapElement, SourceMapElement::ValueType, false> {
+            bool operator()(const SourceMapElement* e) const
+            {
+                return false;
+            }
+        };
+
         template <>
         struct IsExpandable<EnumElement, EnumElement::ValueType, false> {
             bool operator()(const EnumElement* e) const
@@ -140,7 +148,7 @@ namespace refract
                         return true;
                 }
 
-                const auto it = e->attributes().find("enumerations");
+                const auto it = e->attributes().find(symbols::enumerations);
                 if (it != e->attributes().end()) {
                     IsExpandableVisitor v;
                     VisitBy(*it->second, v);
@@ -181,6 +189,7 @@ namespace refract
     template void IsExpandableVisitor::operator()<ExtendElement>(const ExtendElement&);
     template void IsExpandableVisitor::operator()<OptionElement>(const OptionElement&);
     template void IsExpandableVisitor::operator()<SelectElement>(const SelectElement&);
+    template void IsExpandableVisitor::operator()<SourceMapElement>(const SourceMapElement&);
 
     bool IsExpandableVisitor::get() const
     {
@@ -341,6 +341,7 @@ namespace
     void renderPropertySpecific(ObjectSchema& schema, const OptionElement& element, TypeAttributes options);
     void renderPropertySpecific(ObjectSchema& schema, const RefElement& element, TypeAttributes options);
     void renderPropertySpecific(ObjectSchema& schema, const SelectElement& element, TypeAttributes options);
+    void renderPropertySpecific(ObjectSchema& schema, const SourceMapElement& element, TypeAttributes options);
     void renderPropertySpecific(ObjectSchema& schema, const StringElement& element, TypeAttributes options);
     void renderProperty(ObjectSchema& schema, const IElement& element, TypeAttributes options);
 
@@ -356,6 +357,7 @@ namespace
     so::Object& renderSchemaSpecific(so::Object& schema, const OptionElement& element, TypeAttributes options);
     so::Object& renderSchemaSpecific(so::Object& schema, const RefElement& element, TypeAttributes options);
     so::Object& renderSchemaSpecific(so::Object& schema, const SelectElement& element, TypeAttributes options);
+    so::Object& renderSchemaSpecific(so::Object& schema, const SourceMapElement& element, TypeAttributes options);
     so::Object& renderSchemaSpecific(so::Object& schema, const StringElement& element, TypeAttributes options);
     so::Object& renderSchema(so::Object& schema, const IElement& element, TypeAttributes options);
 }
@@ -486,7 +488,7 @@ namespace
         if (options.test(NULLABLE_FLAG))
             so::emplace_unique(enm, so::Null{});
 
-        auto enumerationsIt = e.attributes().find("enumerations");
+        auto enumerationsIt = e.attributes().find(symbols::enumerations);
         if (e.attributes().end() != enumerationsIt) {
 
             const auto enums = get<const ArrayElement>(enumerationsIt->second.get());
@@ -601,6 +603,11 @@ namespace
         return errorByImpossibleSchema(s, e);
     }
 
+    so::Object& renderSchemaSpecific(so::Object& s, const SourceMapElement& e, TypeAttributes options)
+    {
+        return errorByImpossibleSchema(s, e);
+    }
+
     so::Object& renderSchemaSpecific(so::Object& s, const StringElement& e, TypeAttributes options)
     {
         return renderSchemaPrimitive(s, e, options);
@@ -686,6 +693,11 @@ namespace
         errorButSkipProperty(element);
     }
 
+    void renderPropertySpecific(ObjectSchema&, const SourceMapElement& element, TypeAttributes)
+    {
+        errorButSkipProperty(element);
+    }
+
     void renderPropertySpecific(ObjectSchema& s, const MemberElement& e, TypeAttributes options)
     {
         if (hasFixedTypeAttr(e))
@@ -77,6 +77,7 @@ namespace
     void renderPropertySpecific(so::Object& obj, const OptionElement& element, TypeAttributes options);
     void renderPropertySpecific(so::Object& obj, const RefElement& element, TypeAttributes options);
     void renderPropertySpecific(so::Object& obj, const SelectElement& element, TypeAttributes options);
+    void renderPropertySpecific(so::Object& obj, const SourceMapElement& element, TypeAttributes options);
     void renderPropertySpecific(so::Object& obj, const StringElement& element, TypeAttributes options);
     void renderProperty(so::Object& obj, const IElement& element, TypeAttributes options);
 
@@ -92,6 +93,7 @@ namespace
     so::Value renderValueSpecific(const OptionElement& element, TypeAttributes options);
     so::Value renderValueSpecific(const RefElement& element, TypeAttributes options);
     so::Value renderValueSpecific(const SelectElement& element, TypeAttributes options);
+    so::Value renderValueSpecific(const SourceMapElement& element, TypeAttributes options);
     so::Value renderValueSpecific(const StringElement& element, TypeAttributes options);
     so::Value renderValue(const IElement& element, TypeAttributes options);
 
@@ -107,6 +109,7 @@ namespace
     void renderItemSpecific(so::Array& array, const OptionElement& element, TypeAttributes options);
     void renderItemSpecific(so::Array& array, const RefElement& element, TypeAttributes options);
     void renderItemSpecific(so::Array& array, const SelectElement& element, TypeAttributes options);
+    void renderItemSpecific(so::Array& array, const SourceMapElement& element, TypeAttributes options);
     void renderItemSpecific(so::Array& array, const StringElement& element, TypeAttributes options);
     void renderItem(so::Array& array, const IElement& element, TypeAttributes options);
 }
@@ -196,6 +199,11 @@ namespace
         return errorByNull(element);
     }
 
+    so::Value renderValueSpecific(const SourceMapElement& element, TypeAttributes options)
+    {
+        return errorByNull(element);
+    }
+
     so::Value renderValueSpecific(const HolderElement& element, TypeAttributes options)
     {
         if (!element.empty() && element.get().data())
@@ -250,7 +258,7 @@ namespace
                 return std::move(alt.second);
 
             LOG(info) << "no value found for EnumElement; searching in `enumerations`";
-            auto enumerationsIt = element.attributes().find("enumerations");
+            auto enumerationsIt = element.attributes().find(symbols::enumerations);
             if (element.attributes().end() != enumerationsIt) {
                 const auto enums = get<const ArrayElement>(enumerationsIt->second.get());
                 assert(enums);
@@ -350,6 +358,11 @@ namespace
         errorButSkipProperty(element);
     }
 
+    void renderPropertySpecific(so::Object& obj, const SourceMapElement& element, TypeAttributes options)
+    {
+        errorButSkipProperty(element);
+    }
+
     void renderPropertySpecific(so::Object& obj, const HolderElement& element, TypeAttributes options)
     {
         if (!element.empty() && element.get().data())
@@ -515,6 +528,11 @@ namespace
         errorButSkipItem(element);
     };
 
+    void renderItemSpecific(so::Array& array, const SourceMapElement& element, TypeAttributes options)
+    {
+        errorButSkipItem(element);
+    };
+
     void renderItemSpecific(so::Array& array, const RefElement& element, TypeAttributes options)
     {
         const IElement* resolved = resolve(element);
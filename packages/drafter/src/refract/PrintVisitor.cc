@@ -8,6 +8,7 @@
 
 #include "PrintVisitor.h"
 
+#include <atomic>
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -93,7 +94,7 @@ namespace refract
 
         PrintVisitor renderer{ indent + 1, os, ommitSourceMap };
         for (const auto& a : e.attributes()) {
-            if (a.first == "sourceMap")
+            if (a.first == symbols::sourceMap)
                 continue;
 
             renderer.indented() << "- `" << a.first << "`\n";
@@ -212,6 +213,15 @@ namespace refract
         printValues(e, "Select");
     }
 
+    void PrintVisitor::operator()(const SourceMapElement& e)
+    {
+        indented() << "- SourceMap";
+        if (!e.empty())
+            for (const auto& range : e.get().ranges())
+                os << ' ' << range.location << ':' << range.length;
+        os << '\n';
+    }
+
     void PrintVisitor::Visit(const IElement& e)
     {
         PrintVisitor ps;
@@ -220,11 +230,12 @@ namespace refract
 
     int log_to_files(const IElement& e, const std::string& name /*= "print"*/)
     {
-        static int i = 0;
+        static std::atomic<int> counter{ 0 };
+        const int i = counter++;
         std::ofstream out(std::to_string(i) + "-" + name + ".log");
         PrintVisitor printer(0, out);
         Visit(printer, e);
-        return i++;
+        return i;
     }
 
 }; // namespace refract
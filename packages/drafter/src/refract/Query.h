@@ -23,7 +23,7 @@ namespace refract
 
         class Element
         {
-            const std::string name;
+            const Symbol name;
 
         public:
             Element(const std::string& name) : name(name) {}
@@ -54,7 +54,7 @@ namespace
 {
     std::string getElementId(const IElement& element)
     {
-        auto it = element.meta().find("id");
+        auto it = element.meta().find(symbols::id);
 
         if (it == element.meta().end()) {
             throw LogicError("Element has no ID");
@@ -83,7 +83,7 @@ bool Registry::add(std::unique_ptr<IElement> element)
 {
     assert(element);
 
-    auto it = element->meta().find("id");
+    auto it = element->meta().find(symbols::id);
 
     if (it == element->meta().end()) {
         throw LogicError("Element has no ID");
@@ -18,188 +18,269 @@ using namespace drafter::utils::log;
 
 namespace
 {
-    so::Object serialize(const InfoElements& info, bool renderSourceMaps);
-
-    so::Array serializeContent(const dsd::Object& e, bool renderSourceMaps);
-    so::Array serializeContent(const dsd::Array& e, bool renderSourceMaps);
-    so::Value serializeContent(const dsd::Enum& e, bool renderSourceMaps);
-    so::Null serializeContent(const dsd::Null& e, bool renderSourceMaps);
-    so::String serializeContent(const dsd::String& e, bool renderSourceMaps);
-    so::Number serializeContent(const dsd::Number& e, bool renderSourceMaps);
-    so::Value serializeContent(const dsd::Boolean& e, bool renderSourceMaps);
-    so::Array serializeContent(const dsd::Extend& e, bool renderSourceMaps);
-    so::Array serializeContent(const dsd::Select& e, bool renderSourceMaps);
-    so::Array serializeContent(const dsd::Option& e, bool renderSourceMaps);
-    so::Value serializeContent(const dsd::Holder& e, bool renderSourceMaps);
-    so::Object serializeContent(const dsd::Member& e, bool renderSourceMaps);
-    so::String serializeContent(const dsd::Ref& e, bool renderSourceMaps);
+    void serialize(const InfoElements& info, bool renderSourceMaps, so::Writer& out);
+
+    void serializeContent(const dsd::Object& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Array& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Enum& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Null& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::String& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Number& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Boolean& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Extend& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Select& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Option& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Holder& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Member& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::Ref& e, bool renderSourceMaps, so::Writer& out);
+    void serializeContent(const dsd::SourceMap& e, bool renderSourceMaps, so::Writer& out);
 
     struct SerializeContentVisitor {
         bool renderSourceMaps;
+        so::Writer& out;
 
         template <typename ElementT>
-        so::Value operator()(const ElementT& el) const
+        void operator()(const ElementT& el) const
         {
-            return serializeContent(el.get(), renderSourceMaps);
+            serializeContent(el.get(), renderSourceMaps, out);
         }
     };
 
-    so::Object serializeAny(const IElement& e, bool renderSourceMaps)
+    bool isRendered(const InfoElements::value_type& entry, bool renderSourceMaps)
     {
-        so::Object result;
+        return renderSourceMaps || entry.first != symbols::sourceMap;
+    }
+
+    bool anyRendered(const InfoElements& info, bool renderSourceMaps)
+    {
+        for (const auto& entry : info)
+            if (isRendered(entry, renderSourceMaps))
+                return true;
+        return false;
+    }
+
+    void serializeAny(const IElement& e, bool renderSourceMaps, so::Writer& out)
+    {
+        out.begin_object();
 
         LOG(debug) << "Serializing element `" << e.element() << "`";
-        result.data.emplace_back("element", so::String{ e.element() });
+        out.key("element");
+        out.string(e.element());
 
-        {
+        if (anyRendered(e.meta(), renderSourceMaps)) {
             LOG(debug) << "Serializing meta of absolute length " << e.meta().size();
-            auto meta = serialize(e.meta(), renderSourceMaps);
-            if (!meta.data.empty())
-                result.data.emplace_back("meta", std::move(meta));
-
+            out.key("meta");
+            serialize(e.meta(), renderSourceMaps, out);
             LOG(debug) << "Serializing meta of absolute length " << e.meta().size() << " [DONE]";
         }
 
-        {
+        const bool renderAttributeSourceMaps = renderSourceMaps || e.element() == "annotation";
+        if (anyRendered(e.attributes(), renderAttributeSourceMaps)) {
             LOG(debug) << "Serializing attribute of absolute length " << e.attributes().size();
-            auto attr = serialize(e.attributes(), renderSourceMaps || e.element() == "annotation");
-            if (!attr.data.empty())
-                result.data.emplace_back("attributes", std::move(attr));
-
+            out.key("attributes");
+            serialize(e.attributes(), renderAttributeSourceMaps, out);
             LOG(debug) << "Serializing attribute of absolute length " << e.attributes().size() << " [DONE]";
         }
 
         if (!e.empty()) {
-            result.data.emplace_back("content", visit(e, SerializeContentVisitor{ renderSourceMaps }));
+            out.key("content");
+            visit(e, SerializeContentVisitor{ renderSourceMaps, out });
         }
 
-        return result;
+        out.end_object();
     }
 } // namespace
 
 namespace
 {
-    so::Object serialize(const InfoElements& info, bool renderSourceMaps)
+    void serialize(const InfoElements& info, bool renderSourceMaps, so::Writer& out)
     {
-        so::Object result;
+        out.begin_object();
         for (const auto& entry : info) {
             assert(entry.second);
-            if (renderSourceMaps || entry.first != "sourceMap")
-                result.data.emplace_back(entry.first, serializeAny(*entry.second, renderSourceMaps));
+            if (isRendered(entry, renderSourceMaps)) {
+                out.key(entry.first);
+                serializeAny(*entry.second, renderSourceMaps, out);
+            }
         }
-        return result;
+        out.end_object();
     }
 
     template <typename ValueT>
-    so::Array serializeListContent(const ValueT& e, bool renderSourceMaps)
+    void serializeListContent(const ValueT& e, bool renderSourceMaps, so::Writer& out)
     {
-        so::Array result;
+        out.begin_array();
 
         for (const auto& entry : e) {
             assert(entry);
-            result.data.emplace_back(serializeAny(*entry, renderSourceMaps));
+            serializeAny(*entry, renderSourceMaps, out);
         }
 
-        return result;
+        out.end_array();
     }
 
 } // namespace
 
 namespace
 {
-    so::Array serializeContent(const dsd::Object& value, bool renderSourceMaps)
+    void serializeContent(const dsd::Object& value, bool renderSourceMaps, so::Writer& out)
     {
         LOG(debug) << "Serializing ObjectElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Array serializeContent(const dsd::Array& value, bool renderSourceMaps)
+    void serializeContent(const dsd::Array& value, bool renderSourceMaps, so::Writer& out)
     {
         LOG(debug) << "Serializing ArrayElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Value serializeContent(const dsd::Enum& value, bool renderSourceMaps)
+    void serializeContent(const dsd::Enum& value, bool renderSourceMaps, so::Writer& out)
     {
         LOG(debug) << "Serializing EnumElement content";
         assert(value.value());
-        return serializeAny(*value.value(), renderSourceMaps);
+        serializeAny(*value.value(), renderSourceMaps, out);
     }
 
-    so::Null serializeContent(const dsd::Null& value, bool)
+    void serializeContent(const dsd::Null& value, bool, so::Writer& out)
     {
         LOG(debug) << "Serializing NullElement content";
-        return so::Null{};
+        out.null();
     }
 
-    so::String serializeContent(const dsd::String& value, bool)
+    void serializeContent(const dsd::String& value, bool, so::Writer& out)
     {
         LOG(debug) << "Serializing StringElement content";
-        return so::String{ value.get() };
+        out.string(value.get());
     }
 
-    so::Number serializeContent(const dsd::Number& value, bool)
+    void serializeContent(const dsd::Number& value, bool, so::Writer& out)
     {
         LOG(debug) << "Serializing NumberElement content";
-        return so::Number{ value.get() };
+        out.number(value.get());
     }
 
-    so::Value serializeContent(const dsd::Boolean& value, bool)
+    void serializeContent(const dsd::Boolean& value, bool, so::Writer& out)
     {
         LOG(debug) << "Serializing BooleanElement content";
-        if (value.get())
-            return so::True{};
-        return so::False{};
+        out.boolean(value.get());
     }
 
-    so::Array serializeContent(const dsd::Extend& value, bool renderSourceMaps)
+    void serializeContent(const dsd::Extend& value, bool renderSourceMaps, so::Writer& out)
     {
         LOG(debug) << "Serializing ExtendElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Array serializeContent(const dsd::Select& value, bool renderSourceMaps)
+    void serializeContent(const dsd::Select& value, bool renderSourceMaps, so::Writer& out)
     {
         LOG(debug) << "Serializing SelectElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Array serializeContent(const dsd::Option& value, bool renderSourceMaps)
+    void serializeContent(const dsd::Option& value, bool renderSourceMaps, so::Writer& out)
     {
         LOG(debug) << "Serializing OptionElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Value serializeContent(const dsd::Holder& value, bool renderSourceMaps)
+    void serializeContent(const dsd::Holder& value, bool renderSourceMaps, so::Writer& out)
     {
         LOG(debug) << "Serializing HolderElement content";
         assert(value.data());
-        return serializeAny(*value.data(), renderSourceMaps);
+        serializeAny(*value.data(), renderSourceMaps, out);
     }
 
-    so::Object serializeContent(const dsd::Member& value, bool renderSourceMaps)
+    void serializeContent(const dsd::Member& value, bool renderSourceMaps, so::Writer& out)
     {
         LOG(debug) << "Serializing MemberElement content";
-        so::Object result;
+        out.begin_object();
 
         assert(value.key());
-        result.data.emplace_back("key", serializeAny(*value.key(), renderSourceMaps));
+        out.key("key");
+        serializeAny(*value.key(), renderSourceMaps, out);
 
-        if (const auto v = value.value())
-            result.data.emplace_back("value", serializeAny(*v, renderSourceMaps));
-        return result;
+        if (const auto v = value.value()) {
+            out.key("value");
+            serializeAny(*v, renderSourceMaps, out);
+        }
+
+        out.end_object();
     }
 
-    so::String serializeContent(const dsd::Ref& value, bool)
+    void serializeContent(const dsd::Ref& value, bool, so::Writer& out)
     {
         LOG(debug) << "Serializing RefElement content";
-        return so::String{ value.symbol() };
+        out.string(value.symbol());
+    }
+
+    // Renders a Number Element as `from_primitive` would
+    void serializeNumber(std::size_t value, so::Writer& out)
+    {
+        out.begin_object();
+        out.key("element");
+        out.string(dsd::Number::name);
+        out.key("content");
+        out.number(std::to_string(value));
+        out.end_object();
+    }
+
+    // Renders a Number Element with `line` and `column` attributes
+    void serializeNumber(std::size_t value, std::size_t line, std::size_t column, so::Writer& out)
+    {
+        out.begin_object();
+        out.key("element");
+        out.string(dsd::Number::name);
+        out.key("attributes");
+        out.begin_object();
+        out.key("line");
+        serializeNumber(line, out);
+        out.key("column");
+        serializeNumber(column, out);
+        out.end_object();
+        out.key("content");
+        out.number(std::to_string(value));
+        out.end_object();
+    }
+
+    // Renders ranges as an Array of `[location, length]` Number Array pairs
+    void serializeContent(const dsd::SourceMap& value, bool, so::Writer& out)
+    {
+        LOG(debug) << "Serializing SourceMapElement content";
+        const auto& ranges = value.ranges();
+        const auto& spans = value.spans();
+
+        out.begin_array();
+        for (std::size_t i = 0; i < ranges.size(); ++i) {
+            out.begin_object();
+            out.key("element");
+            out.string(dsd::Array::name);
+            out.key("content");
+            out.begin_array();
+            if (spans.empty()) {
+                serializeNumber(ranges[i].location, out);
+                serializeNumber(ranges[i].length, out);
+            } else {
+                serializeNumber(ranges[i].location, spans[i].fromLine, spans[i].fromColumn, out);
+                serializeNumber(ranges[i].length, spans[i].toLine, spans[i].toColumn, out);
+            }
+            out.end_array();
+            out.end_object();
+        }
+        out.end_array();
     }
 
 } // namespace
 
 so::Value serialize::renderSo(const IElement& el, bool sourceMaps)
+{
+    so::ValueWriter out;
+    renderSo(el, sourceMaps, out);
+    return std::move(out.result());
+}
+
+void serialize::renderSo(const IElement& el, bool sourceMaps, so::Writer& out)
 {
     LOG(info) << "Starting API Elements -> SO serialization";
-    return serializeAny(el, sourceMaps);
+    serializeAny(el, sourceMaps, out);
 }
@@ -10,6 +10,7 @@
 #define REFRACT_SERIALIZE_H
 
 #include "../utils/so/Value.h"
+#include "../utils/so/Writer.h"
 #include "ElementIfc.h"
 
 namespace refract
@@ -28,6 +29,17 @@ namespace refract
         ///
         drafter::utils::so::Value renderSo(const IElement& el, bool sourceMaps);
 
+        ///
+        /// Stream an API Element tree in the Simple Object format into
+        /// a Writer, without building the intermediate Value.
+        ///
+        /// @param el           API Element to be translated
+        /// @param sourceMaps   whether to print source maps; source maps on
+        ///                     Annotation Elements are always rendered
+        /// @param out          receiver of the Simple Object events
+        ///
+        void renderSo(const IElement& el, bool sourceMaps, drafter::utils::so::Writer& out);
+
     } // namespace serialize
 } // namespace refract
 
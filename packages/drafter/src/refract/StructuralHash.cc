@@ -0,0 +1,238 @@
+//
+//  refract/StructuralHash.cc
+//  librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "StructuralHash.h"
+
+#include "Element.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <typeinfo>
+
+using namespace refract;
+
+namespace
+{
+    void combine(std::size_t& seed, std::size_t value) noexcept
+    {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+
+    std::size_t hashOf(const std::string& value) noexcept
+    {
+        return std::hash<std::string>{}(value);
+    }
+
+    bool isSourceMap(const InfoElements::value_type& entry) noexcept
+    {
+        return entry.first == symbols::sourceMap;
+    }
+
+    void hashElement(std::size_t& seed, const IElement* e)
+    {
+        combine(seed, e ? structuralHash(*e) : 0);
+    }
+
+    void hashInfo(std::size_t& seed, const InfoElements& info)
+    {
+        std::size_t count = 0;
+
+        for (const auto& entry : info) {
+            if (isSourceMap(entry))
+                continue;
+
+            combine(seed, hashOf(entry.first.str()));
+            hashElement(seed, entry.second.get());
+            ++count;
+        }
+
+        combine(seed, count);
+    }
+
+    template <typename Container>
+    void hashContent(std::size_t& seed, const Container& content)
+    {
+        for (const auto& e : content)
+            hashElement(seed, e.get());
+
+        combine(seed, content.size());
+    }
+
+    void hashContent(std::size_t& seed, const dsd::Member& content)
+    {
+        hashElement(seed, content.key());
+        hashElement(seed, content.value());
+    }
+
+    void hashContent(std::size_t& seed, const dsd::Enum& content)
+    {
+        hashElement(seed, content.value());
+    }
+
+    void hashContent(std::size_t& seed, const dsd::Holder& content)
+    {
+        hashElement(seed, content.data());
+    }
+
+    void hashContent(std::size_t& seed, const dsd::Ref& content)
+    {
+        combine(seed, hashOf(content.symbol()));
+    }
+
+    void hashContent(std::size_t& seed, const dsd::String& content)
+    {
+        combine(seed, hashOf(content.get()));
+    }
+
+    void hashContent(std::size_t& seed, const dsd::Number& content)
+    {
+        combine(seed, hashOf(content.get()));
+    }
+
+    void hashContent(std::size_t& seed, const dsd::Boolean& content)
+    {
+        combine(seed, content.get() ? 1 : 0);
+    }
+
+    void hashContent(std::size_t&, const dsd::Null&) {}
+
+    void hashContent(std::size_t& seed, const dsd::SourceMap& content)
+    {
+        for (const auto& range : content.ranges()) {
+            combine(seed, range.location);
+            combine(seed, range.length);
+        }
+    }
+
+    struct Hash {
+        template <typename ElementT>
+        std::size_t operator()(const ElementT& e) const
+        {
+            std::size_t seed = typeid(ElementT).hash_code();
+
+            combine(seed, hashOf(e.element().str()));
+            hashInfo(seed, e.meta());
+            hashInfo(seed, e.attributes());
+
+            if (!e.empty())
+                hashContent(seed, e.get());
+
+            return seed;
+        }
+    };
+
+    bool equalElements(const IElement* lhs, const IElement* rhs)
+    {
+        return lhs == rhs || (lhs && rhs && structurallyEqual(*lhs, *rhs));
+    }
+
+    bool equalInfo(const InfoElements& lhs, const InfoElements& rhs)
+    {
+        auto l = lhs.begin();
+        auto r = rhs.begin();
+
+        while (true) {
+            l = std::find_if_not(l, lhs.end(), isSourceMap);
+            r = std::find_if_not(r, rhs.end(), isSourceMap);
+
+            if (l == lhs.end() || r == rhs.end())
+                return l == lhs.end() && r == rhs.end();
+
+            if (l->first != r->first || !equalElements(l->second.get(), r->second.get()))
+                return false;
+
+            ++l;
+            ++r;
+        }
+    }
+
+    template <typename Container>
+    bool equalContent(const Container& lhs, const Container& rhs)
+    {
+        return lhs.size() == rhs.size()
+            && std::equal(lhs.begin(),
+                   lhs.end(),
+                   rhs.begin(),
+                   [](const typename Container::value_type& l, const typename Container::value_type& r) {
+                       return equalElements(l.get(), r.get());
+                   });
+    }
+
+    bool equalContent(const dsd::Member& lhs, const dsd::Member& rhs)
+    {
+        return equalElements(lhs.key(), rhs.key()) && equalElements(lhs.value(), rhs.value());
+    }
+
+    bool equalContent(const dsd::Enum& lhs, const dsd::Enum& rhs)
+    {
+        return equalElements(lhs.value(), rhs.value());
+    }
+
+    bool equalContent(const dsd::Holder& lhs, const dsd::Holder& rhs)
+    {
+        return equalElements(lhs.data(), rhs.data());
+    }
+
+    bool equalContent(const dsd::Ref& lhs, const dsd::Ref& rhs)
+    {
+        return lhs == rhs;
+    }
+
+    bool equalContent(const dsd::String& lhs, const dsd::String& rhs)
+    {
+        return lhs == rhs;
+    }
+
+    bool equalContent(const dsd::Number& lhs, const dsd::Number& rhs)
+    {
+        return lhs == rhs;
+    }
+
+    bool equalContent(const dsd::Boolean& lhs, const dsd::Boolean& rhs)
+    {
+        return lhs == rhs;
+    }
+
+    bool equalContent(const dsd::Null&, const dsd::Null&)
+    {
+        return true;
+    }
+
+    bool equalContent(const dsd::SourceMap& lhs, const dsd::SourceMap& rhs)
+    {
+        return lhs == rhs;
+    }
+
+    struct Equal {
+        const IElement& rhs;
+
+        template <typename ElementT>
+        bool operator()(const ElementT& lhs) const
+        {
+            const auto* r = dynamic_cast<const ElementT*>(&rhs);
+
+            return r                                                  //
+                && (lhs.element() == r->element())                    //
+                && (lhs.empty() == r->empty())                        //
+                && equalInfo(lhs.meta(), r->meta())                   //
+                && equalInfo(lhs.attributes(), r->attributes())       //
+                && (lhs.empty() || equalContent(lhs.get(), r->get())); //
+        }
+    };
+}
+
+std::size_t refract::structuralHash(const IElement& e)
+{
+    return visit(e, Hash{});
+}
+
+bool refract::structurallyEqual(const IElement& lhs, const IElement& rhs)
+{
+    return &lhs == &rhs || visit(lhs, Equal{ rhs });
+}
@@ -0,0 +1,34 @@
+//
+//  refract/StructuralHash.h
+//  librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef REFRACT_STRUCTURAL_HASH_H
+#define REFRACT_STRUCTURAL_HASH_H
+
+#include "ElementIfc.h"
+
+#include <cstddef>
+
+namespace refract
+{
+    ///
+    /// Hash of an Element, its meta, attributes and content at any depth,
+    /// ignoring source maps
+    ///
+    /// Elements equal by structurallyEqual have equal hashes.
+    ///
+    std::size_t structuralHash(const IElement& e);
+
+    ///
+    /// Query whether two Elements are equal but for their source maps
+    ///
+    /// Compares element names, meta, attributes (but `sourceMap`) and content
+    /// at any depth; entries of meta and attributes are compared in order.
+    ///
+    bool structurallyEqual(const IElement& lhs, const IElement& rhs);
+}
+
+#endif
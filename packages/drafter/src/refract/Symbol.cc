@@ -0,0 +1,118 @@
+//
+//  refract/Symbol.cc
+//  librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "Symbol.h"
+
+#include <ostream>
+#include <unordered_set>
+
+using namespace refract;
+
+namespace
+{
+    using Vocabulary = std::unordered_set<std::string>;
+
+    const Vocabulary& vocabulary()
+    {
+        static const Vocabulary words = {
+            // Element names
+            "",
+            "annotation",
+            "api",
+            "array",
+            "asset",
+            "boolean",
+            "category",
+            "copy",
+            "dataStructure",
+            "enum",
+            "extend",
+            "generic",
+            "hrefVariables",
+            "httpHeaders",
+            "httpRequest",
+            "httpResponse",
+            "httpTransaction",
+            "link",
+            "member",
+            "null",
+            "number",
+            "object",
+            "option",
+            "parseResult",
+            "ref",
+            "resource",
+            "select",
+            "sourceMap",
+            "string",
+            "transition",
+            // meta & attribute keys
+            "classes",
+            "code",
+            "contentType",
+            "default",
+            "description",
+            "enumerations",
+            "href",
+            "id",
+            "links",
+            "method",
+            "relation",
+            "resolved",
+            "samples",
+            "statusCode",
+            "title",
+            "typeAttributes",
+            "variable",
+            // values of typeAttributes & classes
+            "fixed",
+            "fixedType",
+            "nullable",
+            "optional",
+            "required",
+            "error",
+            "warning",
+            "messageBody",
+            "messageBodySchema",
+            "user",
+        };
+        return words;
+    }
+
+    std::shared_ptr<const std::string> intern(const std::string& value)
+    {
+        const auto& words = vocabulary();
+        auto it = words.find(value);
+
+        if (it != words.end())
+            return std::shared_ptr<const std::string>(std::shared_ptr<const std::string>(), &*it); // not owned
+
+        return std::make_shared<const std::string>(value);
+    }
+}
+
+Symbol::Symbol() : value_(std::shared_ptr<const std::string>(), &*vocabulary().find(std::string())) {}
+
+Symbol::Symbol(const std::string& value) : value_(intern(value)) {}
+
+Symbol::Symbol(const char* value) : value_(intern(value)) {}
+
+std::ostream& refract::operator<<(std::ostream& out, const Symbol& symbol)
+{
+    return out << symbol.str();
+}
+
+const Symbol symbols::id{ "id" };
+const Symbol symbols::ref{ "ref" };
+const Symbol symbols::sourceMap{ "sourceMap" };
+const Symbol symbols::enumerations{ "enumerations" };
+const Symbol symbols::typeAttributes{ "typeAttributes" };
+const Symbol symbols::samples{ "samples" };
+const Symbol symbols::default_{ "default" };
+const Symbol symbols::variable{ "variable" };
+const Symbol symbols::resolved{ "resolved" };
+const Symbol symbols::description{ "description" };
@@ -0,0 +1,144 @@
+//
+//  refract/Symbol.h
+//  librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef REFRACT_SYMBOL_H
+#define REFRACT_SYMBOL_H
+
+#include <cstring>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+namespace refract
+{
+    ///
+    /// Immutable string naming Elements and their meta/attribute entries
+    ///
+    /// Names from the API Elements vocabulary ("string", "member", "id",
+    /// "sourceMap", ...) are interned in a static table; Symbols of them are
+    /// pointers into that table and are compared by identity. Other names
+    /// (e.g. of named types) are held in a buffer shared by copies.
+    ///
+    class Symbol final
+    {
+        std::shared_ptr<const std::string> value_;
+
+    public:
+        ///
+        /// Initialize the empty Symbol
+        ///
+        Symbol();
+
+        explicit Symbol(const std::string& value);
+        explicit Symbol(const char* value);
+
+    public:
+        const std::string& str() const noexcept
+        {
+            return *value_;
+        }
+
+        operator const std::string&() const noexcept
+        {
+            return *value_;
+        }
+
+        const char* c_str() const noexcept
+        {
+            return value_->c_str();
+        }
+
+        bool empty() const noexcept
+        {
+            return value_->empty();
+        }
+
+        ///
+        /// Query whether the Symbol is part of the interned vocabulary
+        ///
+        bool interned() const noexcept
+        {
+            return value_.use_count() == 0; // interned strings are not owned
+        }
+
+        friend bool operator==(const Symbol& lhs, const Symbol& rhs) noexcept
+        {
+            return lhs.value_ == rhs.value_ || (!lhs.interned() && !rhs.interned() && *lhs.value_ == *rhs.value_);
+        }
+    };
+
+    inline bool operator!=(const Symbol& lhs, const Symbol& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator<(const Symbol& lhs, const Symbol& rhs) noexcept
+    {
+        return lhs.str() < rhs.str();
+    }
+
+    inline bool operator==(const Symbol& lhs, const std::string& rhs) noexcept
+    {
+        return lhs.str() == rhs;
+    }
+
+    inline bool operator==(const std::string& lhs, const Symbol& rhs) noexcept
+    {
+        return lhs == rhs.str();
+    }
+
+    inline bool operator!=(const Symbol& lhs, const std::string& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator!=(const std::string& lhs, const Symbol& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator==(const Symbol& lhs, const char* rhs) noexcept
+    {
+        return std::strcmp(lhs.c_str(), rhs) == 0;
+    }
+
+    inline bool operator==(const char* lhs, const Symbol& rhs) noexcept
+    {
+        return rhs == lhs;
+    }
+
+    inline bool operator!=(const Symbol& lhs, const char* rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator!=(const char* lhs, const Symbol& rhs) noexcept
+    {
+        return !(rhs == lhs);
+    }
+
+    std::ostream& operator<<(std::ostream& out, const Symbol& symbol);
+
+    ///
+    /// Interned names of meta and attribute entries used by librefract
+    ///
+    namespace symbols
+    {
+        extern const Symbol id;
+        extern const Symbol ref;
+        extern const Symbol sourceMap;
+        extern const Symbol enumerations;
+        extern const Symbol typeAttributes;
+        extern const Symbol samples;
+        extern const Symbol default_;
+        extern const Symbol variable;
+        extern const Symbol resolved;
+        extern const Symbol description;
+    }
+}
+
+#endif
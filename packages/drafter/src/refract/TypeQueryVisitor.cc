@@ -38,6 +38,7 @@ namespace refract
     VISIT_IMPL(Extend)
     VISIT_IMPL(Option)
     VISIT_IMPL(Select)
+    VISIT_IMPL(SourceMap)
 
     TypeQueryVisitor::ElementType TypeQueryVisitor::get() const
     {
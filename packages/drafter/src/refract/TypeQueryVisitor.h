@@ -38,6 +38,8 @@ namespace refract
             Option,
             Select,
 
+            SourceMap,
+
             Unknown = 0,
         } ElementType;
 
@@ -61,6 +63,7 @@ namespace refract
         void operator()(const ExtendElement& e);
         void operator()(const OptionElement& e);
         void operator()(const SelectElement& e);
+        void operator()(const SourceMapElement& e);
 
         ElementType get() const;
 
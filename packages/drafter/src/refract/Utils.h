@@ -34,6 +34,7 @@ namespace refract
         virtual void operator()(const ExtendElement& e) = 0;
         virtual void operator()(const OptionElement& e) = 0;
         virtual void operator()(const SelectElement& e) = 0;
+        virtual void operator()(const SourceMapElement& e) = 0;
     };
 
     namespace impl
@@ -104,6 +105,10 @@ namespace refract
             {
                 result = f(e);
             }
+            void operator()(const SourceMapElement& e) override
+            {
+                result = f(e);
+            }
         };
 
         // specialization for reference results
@@ -175,6 +180,10 @@ namespace refract
             {
                 result = &f(e);
             }
+            void operator()(const SourceMapElement& e) override
+            {
+                result = &f(e);
+            }
         };
 
         // specialization for void results
@@ -238,6 +247,10 @@ namespace refract
             {
                 f(e);
             }
+            void operator()(const SourceMapElement& e) override
+            {
+                f(e);
+            }
         };
     }
 
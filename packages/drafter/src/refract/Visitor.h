@@ -30,6 +30,7 @@ namespace refract
         virtual void visit(const ExtendElement& e) = 0;
         virtual void visit(const OptionElement& e) = 0;
         virtual void visit(const SelectElement& e) = 0;
+        virtual void visit(const SourceMapElement& e) = 0;
 
         virtual ~IApply() {}
     };
@@ -62,6 +63,7 @@ namespace refract
         APPLY_VISIT_IMPL(ExtendElement)
         APPLY_VISIT_IMPL(OptionElement)
         APPLY_VISIT_IMPL(SelectElement)
+        APPLY_VISIT_IMPL(SourceMapElement)
 
         virtual ~ApplyImpl() {}
     };
@@ -12,7 +12,7 @@ using namespace refract;
 
 const StringElement* refract::GetDescription(const IElement& e)
 {
-    auto i = e.meta().find("description");
+    auto i = e.meta().find(symbols::description);
 
     if (i == e.meta().end()) {
         return nullptr;
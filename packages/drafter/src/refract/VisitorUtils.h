@@ -22,7 +22,7 @@ namespace refract
     template <typename T>
     bool HasTypeAttribute(const T& e, std::string typeAttribute)
     {
-        auto ta = e.attributes().find("typeAttributes");
+        auto ta = e.attributes().find(symbols::typeAttributes);
 
         if (ta == e.attributes().end()) {
             return false;
@@ -50,7 +50,7 @@ namespace refract
     template <typename T>
     bool IsVariableProperty(const T& e)
     {
-        auto const var = e.attributes().find("variable");
+        auto const var = e.attributes().find(symbols::variable);
 
         if (var == e.attributes().end()) {
             return false;
@@ -63,7 +63,7 @@ namespace refract
     template <typename T>
     const T* GetDefault(const T& e)
     {
-        auto const dflt = e.attributes().find("default");
+        auto const dflt = e.attributes().find(symbols::default_);
 
         if (dflt == e.attributes().end()) {
             return NULL;
@@ -75,7 +75,7 @@ namespace refract
     template <typename T>
     const T* GetSample(const T& e)
     {
-        auto const i = e.attributes().find("samples");
+        auto const i = e.attributes().find(symbols::samples);
 
         if (i == e.attributes().end()) {
             return nullptr;
@@ -174,7 +174,7 @@ namespace refract
 
         const ArrayElement* GetEnumerations(const EnumElement& e) const
         {
-            auto i = e.attributes().find("enumerations");
+            auto i = e.attributes().find(symbols::enumerations);
 
             if (i == e.attributes().end()) {
                 return nullptr;
@@ -202,7 +202,7 @@ namespace refract
     template <typename T, typename Collection, typename Functor>
     void HandleRefWhenFetchingMembers(const refract::IElement& e, Collection& members, const Functor& functor)
     {
-        auto found = e.attributes().find("resolved");
+        auto found = e.attributes().find(symbols::resolved);
 
         if (found == e.attributes().end()) {
             return;
@@ -10,8 +10,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <map>
 #include <set>
+#include <unordered_map>
 
 #include "../Exception.h"
 #include "../Element.h"
@@ -82,75 +84,124 @@ namespace
         }
     };
 
+    const std::string& keyOf(const MemberElement& member)
+    {
+        static const std::string none;
+
+        auto key = TypeQueryVisitor::as<const StringElement>(member.get().key());
+        assert(key);
+
+        return key->empty() ? none : key->get().get();
+    }
+
+    const std::string& symbolOf(const RefElement& ref)
+    {
+        static const std::string none;
+        return ref.empty() ? none : ref.get().symbol();
+    }
+
+    /**
+     * Positions of the entries of an Object's value by which merged entries replace them:
+     * members by key, including members of select options, and references by symbol */
+    class ObjectMergeIndex
+    {
+        using Positions = std::set<std::size_t>;
+        using Index = std::unordered_map<std::string, Positions>;
+
+        Index members_;
+        Index refs_;
+
+        template <typename Callback>
+        static void forEachKey(const IElement& e, Callback callback)
+        {
+            if (auto member = TypeQueryVisitor::as<const MemberElement>(&e)) {
+                callback(false, keyOf(*member));
+            } else if (auto select = TypeQueryVisitor::as<const SelectElement>(&e)) {
+                for (const auto& option : select->get())
+                    for (const auto& optEl : option->get())
+                        if (auto optElMember = TypeQueryVisitor::as<const MemberElement>(optEl.get()))
+                            callback(false, keyOf(*optElMember));
+            } else if (auto ref = TypeQueryVisitor::as<const RefElement>(&e)) {
+                callback(true, symbolOf(*ref));
+            }
+        }
+
+    public:
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        explicit ObjectMergeIndex(const dsd::Object& value)
+        {
+            std::size_t position = 0;
+            for (const auto& e : value)
+                add(*e, position++);
+        }
+
+        void add(const IElement& e, std::size_t position)
+        {
+            forEachKey(e, [this, position](bool isRef, const std::string& key) {
+                (isRef ? refs_ : members_)[key].insert(position);
+            });
+        }
+
+        void remove(const IElement& e, std::size_t position)
+        {
+            forEachKey(e, [this, position](bool isRef, const std::string& key) {
+                auto& index = isRef ? refs_ : members_;
+                auto it = index.find(key);
+                if (it != index.end())
+                    it->second.erase(position);
+            });
+        }
+
+        /**
+         * @return position of the first entry replaced by merging a member or reference;
+         *         npos if there is none */
+        std::size_t find(const IElement& merged) const
+        {
+            const Index* index = nullptr;
+            const std::string* key = nullptr;
+
+            if (auto member = TypeQueryVisitor::as<const MemberElement>(&merged)) {
+                index = &members_;
+                key = &keyOf(*member);
+            } else if (auto ref = TypeQueryVisitor::as<const RefElement>(&merged)) {
+                index = &refs_;
+                key = &symbolOf(*ref);
+            } else {
+                return npos;
+            }
+
+            auto it = index->find(*key);
+            return (it == index->end() || it->second.empty()) ? npos : *it->second.begin();
+        }
+    };
+
+    constexpr std::size_t ObjectMergeIndex::npos;
+
     template <>
     struct ValueMerge<ObjectElement, true> {
 
         void operator()(ObjectElement& value, const ObjectElement& merge) const
         {
             if (!merge.empty()) {
+                if (value.empty())
+                    value.set();
+
+                auto& entries = value.get();
+                ObjectMergeIndex index(entries);
+
                 for (const auto& m : merge.get()) {
-                    if (value.empty())
-                        value.set();
-                    auto valueMatch = [&value, &m]() {
-                        if (auto mergeMember = TypeQueryVisitor::as<const MemberElement>(m.get())) {
-                            assert(mergeMember);
-
-                            auto mergeKey = TypeQueryVisitor::as<const StringElement>(mergeMember->get().key());
-                            assert(mergeKey);
-
-                            return std::find_if(
-                                value.get().begin(), value.get().end(), [mergeKey](const std::unique_ptr<IElement>& e) {
-                                    if (auto valueMember = TypeQueryVisitor::as<const MemberElement>(e.get())) {
-                                        auto valueKey
-                                            = TypeQueryVisitor::as<const StringElement>(valueMember->get().key());
-                                        assert(valueKey);
-
-                                        return mergeKey->get() == valueKey->get();
-                                    }
-
-                                    if (auto valueSelect = TypeQueryVisitor::as<const SelectElement>(e.get())) {
-                                        return valueSelect->get().end()
-                                            != std::find_if(valueSelect->get().begin(),
-                                                   valueSelect->get().end(),
-                                                   [mergeKey](const std::unique_ptr<OptionElement>& option) {
-                                                       return option->get().end()
-                                                           != std::find_if(option->get().begin(),
-                                                                  option->get().end(),
-                                                                  [mergeKey](const std::unique_ptr<IElement>& optEl) {
-                                                                      if (auto optElMember
-                                                                          = TypeQueryVisitor::as<const MemberElement>(
-                                                                              optEl.get())) {
-                                                                          auto optElMemberKey = TypeQueryVisitor::as<
-                                                                              const StringElement>(
-                                                                              optElMember->get().key());
-                                                                          assert(optElMemberKey);
-                                                                          return optElMemberKey->get()
-                                                                              == mergeKey->get();
-                                                                      }
-                                                                      return false;
-                                                                  });
-                                                   });
-                                    }
-
-                                    return false;
-                                });
-                        } else if (auto mergeRef = TypeQueryVisitor::as<const RefElement>(m.get())) {
-                            return std::find_if(
-                                value.get().begin(), value.get().end(), [mergeRef](const std::unique_ptr<IElement>& e) {
-                                    if (auto valueRef = TypeQueryVisitor::as<const RefElement>(e.get()))
-                                        return mergeRef->get() == valueRef->get();
-                                    else
-                                        return false;
-                                });
-                        } else {
-                            return value.get().end();
-                        }
-                    }();
+                    const auto position = index.find(*m);
 
-                    if (valueMatch == value.get().end()) {
-                        value.get().push_back(clone(*m));
+                    if (position == ObjectMergeIndex::npos) {
+                        // not push_back, there is no member of the key to be replaced
+                        index.add(*m, entries.size());
+                        entries.insert(entries.end(), clone(*m));
                     } else {
-                        value.get().insert(value.get().erase(valueMatch), clone(*m));
+                        auto& entry = *(entries.begin() + position);
+                        index.remove(*entry, position);
+                        index.add(*m, position);
+                        entry = clone(*m);
                     }
                 }
             }
@@ -211,8 +262,8 @@ namespace
             InfoMerge<SkipMetaKeywords>{}(target.meta(), append.meta());
             InfoMerge<SkipEnumerations>{}(target.attributes(), append.attributes());
 
-            auto target_enums_it = target.attributes().find("enumerations");
-            auto append_enums_it = append.attributes().find("enumerations");
+            auto target_enums_it = target.attributes().find(symbols::enumerations);
+            auto append_enums_it = append.attributes().find(symbols::enumerations);
 
             if (append_enums_it != append.attributes().end()) {
                 auto append_enums = TypeQueryVisitor::as<const ArrayElement>(append_enums_it->second.get());
@@ -221,7 +272,7 @@ namespace
                 assert(!append_enums->empty());
                 if (!append_enums->get().empty()) {
                     if (target_enums_it == target.attributes().end()) {
-                        target.attributes().set("enumerations", clone(*append_enums));
+                        target.attributes().set(symbols::enumerations, clone(*append_enums));
                     } else {
                         auto target_enums = TypeQueryVisitor::as<ArrayElement>(target_enums_it->second.get());
                         assert(target_enums);
@@ -0,0 +1,59 @@
+//
+//  refract/dsd/SourceMap.cc
+//  librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "SourceMap.h"
+
+#include "Traits.h"
+
+#include <cassert>
+
+using namespace refract;
+using namespace dsd;
+
+const char* SourceMap::name = "sourceMap";
+
+static_assert(!supports_erase<SourceMap>::value, "");
+static_assert(!supports_empty<SourceMap>::value, "");
+static_assert(!supports_insert<SourceMap>::value, "");
+static_assert(!supports_push_back<SourceMap>::value, "");
+static_assert(!supports_begin<SourceMap>::value, "");
+static_assert(!supports_end<SourceMap>::value, "");
+static_assert(!supports_size<SourceMap>::value, "");
+static_assert(!is_iterable<SourceMap>::value, "");
+static_assert(!supports_key<SourceMap>::value, "");
+static_assert(!supports_value<SourceMap>::value, "");
+static_assert(!supports_merge<SourceMap>::value, "");
+static_assert(!is_pair<SourceMap>::value, "");
+
+SourceMap::SourceMap(std::vector<Range> ranges) : ranges_(std::move(ranges)) {}
+
+SourceMap::SourceMap(std::vector<Range> ranges, std::vector<Span> spans)
+    : ranges_(std::move(ranges)), spans_(std::move(spans))
+{
+    assert(spans_.empty() || spans_.size() == ranges_.size());
+}
+
+bool dsd::operator==(const SourceMap::Range& lhs, const SourceMap::Range& rhs) noexcept
+{
+    return lhs.location == rhs.location && lhs.length == rhs.length;
+}
+
+bool dsd::operator==(const SourceMap::Span& lhs, const SourceMap::Span& rhs) noexcept
+{
+    return lhs.fromLine == rhs.fromLine && lhs.fromColumn == rhs.fromColumn && lhs.toLine == rhs.toLine
+        && lhs.toColumn == rhs.toColumn;
+}
+
+bool dsd::operator==(const SourceMap& lhs, const SourceMap& rhs) noexcept
+{
+    return lhs.ranges() == rhs.ranges() && lhs.spans() == rhs.spans();
+}
+
+bool dsd::operator!=(const SourceMap& lhs, const SourceMap& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
@@ -0,0 +1,94 @@
+//
+//  refract/dsd/SourceMap.h
+//  librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef REFRACT_DSD_SOURCEMAP_H
+#define REFRACT_DSD_SOURCEMAP_H
+
+#include <cstddef>
+#include <vector>
+
+namespace refract
+{
+    namespace dsd
+    {
+        ///
+        /// Data structure definition (DSD) of a Refract Source Map Element
+        ///
+        /// @remark Defined by a flat sequence of character ranges, optionally
+        ///         annotated by line and column of their boundaries. Serialized
+        ///         as an array of `[location, length]` Number pairs.
+        ///
+        class SourceMap final
+        {
+        public:
+            static const char* name; //< syntactical name of the DSD
+
+            /// Character range in the source
+            struct Range {
+                std::size_t location;
+                std::size_t length;
+            };
+
+            /// Line and column of the first and last character of a Range
+            struct Span {
+                std::size_t fromLine;
+                std::size_t fromColumn;
+                std::size_t toLine;
+                std::size_t toColumn;
+            };
+
+        private:
+            std::vector<Range> ranges_ = {}; //< character ranges
+            std::vector<Span> spans_ = {};   //< either empty or one per range
+
+        public:
+            ///
+            /// Initialize an empty SourceMap DSD
+            ///
+            SourceMap() = default;
+
+            ///
+            /// Initialize a SourceMap DSD from character ranges
+            ///
+            explicit SourceMap(std::vector<Range> ranges);
+
+            ///
+            /// Initialize a SourceMap DSD from character ranges and their spans
+            ///
+            /// @remark both vectors must be of same size
+            ///
+            SourceMap(std::vector<Range> ranges, std::vector<Span> spans);
+
+        public:
+            ///
+            /// Query the character ranges
+            ///
+            const std::vector<Range>& ranges() const noexcept
+            {
+                return ranges_;
+            }
+
+            ///
+            /// Query lines and columns of the character ranges
+            ///
+            /// @return spans for each range, or none if not tracked
+            ///
+            const std::vector<Span>& spans() const noexcept
+            {
+                return spans_;
+            }
+        };
+
+        bool operator==(const SourceMap::Range&, const SourceMap::Range&) noexcept;
+        bool operator==(const SourceMap::Span&, const SourceMap::Span&) noexcept;
+
+        bool operator==(const SourceMap&, const SourceMap&) noexcept;
+        bool operator!=(const SourceMap&, const SourceMap&) noexcept;
+    }
+}
+
+#endif
@@ -31,12 +31,14 @@ static_assert(!is_pair<String>::value, "");
 
 String::String(std::string s) noexcept : value_(std::move(s)) {}
 
-bool dsd::operator==(const String& lhs, const String& rhs) noexcept
+String::String(std::shared_ptr<const Deferred> deferred) noexcept : value_(), deferred_(std::move(deferred)) {}
+
+bool dsd::operator==(const String& lhs, const String& rhs)
 {
     return lhs.get() == rhs.get();
 }
 
-bool dsd::operator!=(const String& lhs, const String& rhs) noexcept
+bool dsd::operator!=(const String& lhs, const String& rhs)
 {
     return !(lhs == rhs);
 }
@@ -9,6 +9,7 @@
 #ifndef REFRACT_DSD_STRING_H
 #define REFRACT_DSD_STRING_H
 
+#include <memory>
 #include <string>
 
 namespace refract
@@ -23,7 +24,29 @@ namespace refract
         ///
         class String final
         {
-            std::string value_ = {}; //< value
+        public:
+            ///
+            /// Value of a String DSD computed when first queried
+            ///
+            /// @remark Shared by copies of the DSD; implementations compute
+            ///         the value once even if queried by several threads at once
+            ///
+            class Deferred
+            {
+            public:
+                virtual ~Deferred() = default;
+
+                ///
+                /// Query the value, computing it on first query
+                ///
+                /// @returns the value
+                ///
+                virtual const std::string& get() const = 0;
+            };
+
+        private:
+            std::string value_ = {};                        //< value
+            std::shared_ptr<const Deferred> deferred_ = {}; //< value computed on demand, if any
 
         public:
             static const char* name; //< syntactical name of the DSD
@@ -55,6 +78,13 @@ namespace refract
             ///
             String(std::string value) noexcept;
 
+            ///
+            /// Initialize a String DSD from a value computed when first queried
+            ///
+            /// @deferred  shared source of the value
+            ///
+            explicit String(std::shared_ptr<const Deferred> deferred) noexcept;
+
             ///
             /// Consume another String DSD's value
             ///
@@ -75,9 +105,9 @@ namespace refract
             ///
             /// @returns true iff the values of the DSD equals rhs
             ///
-            friend bool operator==(const String& lhs, const std::string& rhs) noexcept
+            friend bool operator==(const String& lhs, const std::string& rhs)
             {
-                return lhs.value_ == rhs;
+                return lhs.get() == rhs;
             }
 
         public:
@@ -86,9 +116,21 @@ namespace refract
             ///
             /// @returns the value
             ///
-            const std::string& get() const noexcept
+            /// @remark Computes a deferred value on first query
+            ///
+            const std::string& get() const
+            {
+                return deferred_ ? deferred_->get() : value_;
+            }
+
+            ///
+            /// Query whether the value of this String DSD is computed on demand
+            ///
+            /// @returns true iff constructed from a Deferred value
+            ///
+            bool deferred() const noexcept
             {
-                return value_;
+                return deferred_ != nullptr;
             }
 
             ///
@@ -96,9 +138,9 @@ namespace refract
             ///
             /// @returns true iff the value is empty
             ///
-            bool empty() const noexcept
+            bool empty() const
             {
-                return value_.empty();
+                return get().empty();
             }
 
             ///
@@ -108,12 +150,12 @@ namespace refract
             ///
             operator const std::string&() const
             {
-                return value_;
+                return get();
             }
         };
 
-        bool operator==(const String&, const String&) noexcept;
-        bool operator!=(const String&, const String&) noexcept;
+        bool operator==(const String&, const String&);
+        bool operator!=(const String&, const String&);
     }
 }
 
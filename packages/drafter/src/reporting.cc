@@ -9,7 +9,9 @@
 #include "reporting.h"
 
 #include <algorithm>
+#include <iomanip>
 #include <iostream>
+#include <memory>
 
 #include "refract/Element.h"
 #include "refract/FilterVisitor.h"
@@ -41,7 +43,7 @@ namespace
 
     void PrintAnnotation(const std::string& prefix,
         const snowcrash::SourceAnnotation& annotation,
-        const std::string& source,
+        const NewLinesIndex& linesEndIndex,
         const bool useLineNumbers)
     {
 
@@ -55,12 +57,6 @@ namespace
             std::cerr << " " << annotation.message;
         }
 
-        NewLinesIndex linesEndIndex;
-
-        if (useLineNumbers) {
-            linesEndIndex = GetLinesEndIndex(source);
-        }
-
         if (!annotation.location.empty()) {
 
             for (mdp::CharactersRangeSet::const_iterator it = annotation.location.begin();
@@ -87,39 +83,53 @@ namespace
 
     struct AnnotationToString {
 
-        std::vector<size_t> linesEndIndex;
+        const char* source;
+        const std::size_t size;
+        std::shared_ptr<NewLinesIndex> linesEndIndex; // built on first use, shared by copies
         const bool useLineNumbers;
 
-        AnnotationToString(const std::string& source, const bool useLineNumbers) : useLineNumbers(useLineNumbers)
+        AnnotationToString(const char* source, const std::size_t size, const bool useLineNumbers)
+            : source(source),
+              size(size),
+              linesEndIndex(std::make_shared<NewLinesIndex>()),
+              useLineNumbers(useLineNumbers)
         {
-            if (useLineNumbers) {
-                linesEndIndex = GetLinesEndIndex(source);
+        }
+
+        const AnnotationPosition position(const dsd::SourceMap::Range& range, const dsd::SourceMap::Span* span)
+        {
+            AnnotationPosition out;
+
+            // annotations carry their line and column already
+            if (span) {
+                out.fromLine = span->fromLine;
+                out.fromColumn = span->fromColumn;
+                out.toLine = span->toLine;
+                out.toColumn = span->toColumn;
+                return out;
             }
+
+            if (linesEndIndex->empty()) {
+                *linesEndIndex = GetLinesEndIndex(source, size);
+            }
+
+            return GetLineFromMap(*linesEndIndex, mdp::Range(range.location, range.length));
         }
 
-        const std::string location(const IElement* sourceMap)
+        const std::string location(const dsd::SourceMap::Range& range, const dsd::SourceMap::Span* span)
         {
             std::stringstream output;
-            auto map = TypeQueryVisitor::as<const ArrayElement>(sourceMap);
-            if (map && map->get().size() == 2) {
 
-                auto loc = TypeQueryVisitor::as<const NumberElement>(map->get().begin()[0].get());
-                auto len = TypeQueryVisitor::as<const NumberElement>(map->get().begin()[1].get());
-                if (loc && len) {
-
-                    if (useLineNumbers) {
+            if (useLineNumbers) {
 
-                        mdp::Range pos(static_cast<std::int64_t>(loc->get()), static_cast<std::int64_t>(len->get()));
-                        const auto annotationPosition = GetLineFromMap(linesEndIndex, pos);
+                const auto annotationPosition = position(range, span);
 
-                        output << "; line " << annotationPosition.fromLine << ", column "
-                               << annotationPosition.fromColumn;
-                        output << " - line " << annotationPosition.toLine << ", column " << annotationPosition.toColumn;
-                    } else {
-                        output << loc->get() << ":" << len->get();
-                    }
-                }
+                output << "; line " << annotationPosition.fromLine << ", column " << annotationPosition.fromColumn;
+                output << " - line " << annotationPosition.toLine << ", column " << annotationPosition.toColumn;
+            } else {
+                output << range.location << ":" << range.length;
             }
+
             return output.str();
         }
 
@@ -148,17 +158,19 @@ namespace
                 output << message->get();
             }
 
-            if (const ArrayElement* sourceMap
+            if (const ArrayElement* sourceMaps
                 = FindCollectionMemberValue<ArrayElement>(annotation->attributes(), "sourceMap")) {
-                if (sourceMap->get().size() == 1) {
-                    sourceMap = TypeQueryVisitor::as<const ArrayElement>(sourceMap->get().begin()[0].get());
-                    if (sourceMap) {
-                        for (const auto& array : sourceMap->get()) {
+                if (sourceMaps->get().size() == 1) {
+                    auto sourceMap = TypeQueryVisitor::as<const SourceMapElement>(sourceMaps->get().begin()[0].get());
+                    if (sourceMap && !sourceMap->empty()) {
+                        const auto& ranges = sourceMap->get().ranges();
+                        const auto& spans = sourceMap->get().spans();
+                        for (std::size_t i = 0; i < ranges.size(); ++i) {
                             if (!useLineNumbers) {
-                                const char* prefix = array == (*sourceMap->get().begin()) ? " :" : ";";
+                                const char* prefix = i == 0 ? " :" : ";";
                                 output << prefix;
                             }
-                            output << location(array.get());
+                            output << location(ranges[i], spans.empty() ? nullptr : &spans[i]);
                         }
                     }
                 }
@@ -180,31 +192,67 @@ void PrintReport(const snowcrash::Report& report, const std::string& source, con
 
     std::cerr << std::endl;
 
+    NewLinesIndex linesEndIndex;
+
+    if (isUseLineNumbers) {
+        linesEndIndex = GetLinesEndIndex(source);
+    }
+
     if (report.error.code == sc::Error::OK) {
         std::cerr << "OK.\n";
     } else {
-        PrintAnnotation("error:", report.error, source, isUseLineNumbers);
+        PrintAnnotation("error:", report.error, linesEndIndex, isUseLineNumbers);
     }
 
     for (snowcrash::Warnings::const_iterator it = report.warnings.begin(); it != report.warnings.end(); ++it) {
-        PrintAnnotation("warning:", *it, source, isUseLineNumbers);
+        PrintAnnotation("warning:", *it, linesEndIndex, isUseLineNumbers);
     }
 }
 
-void PrintReport(const drafter_result* result, const std::string& source, const bool useLineNumbers, const int error)
+void PrintReport(const drafter_result* result,
+    const char* source,
+    const std::size_t size,
+    const bool useLineNumbers,
+    const int error,
+    std::ostream& out)
 {
-    std::cerr << std::endl;
+    out << std::endl;
 
     FilterVisitor filter(query::Element("annotation"));
     Iterate<Children> iterate(filter);
     iterate(*result);
 
     if (error == sc::Error::OK) {
-        std::cerr << "OK.\n";
+        out << "OK.\n";
     }
 
     std::transform(filter.elements().begin(),
         filter.elements().end(),
-        std::ostream_iterator<std::string>(std::cerr, "\n"),
-        AnnotationToString(source, useLineNumbers));
+        std::ostream_iterator<std::string>(out, "\n"),
+        AnnotationToString(source, size, useLineNumbers));
+}
+
+void PrintStats(const drafter_stats* stats, std::ostream& out)
+{
+    out << std::left << std::setw(16) << "stage" << std::right << std::setw(8) << "calls" << std::setw(12) << "ms"
+        << std::setw(14) << "allocations" << std::setw(14) << "KiB" << std::setw(12) << "elements" << "\n";
+
+    out << std::fixed << std::setprecision(3);
+
+    for (int i = 0; i < DRAFTER_STAGE_COUNT; ++i) {
+        const drafter_stage stage = static_cast<drafter_stage>(i);
+
+        drafter_stage_stats measured;
+        if (drafter_get_stage_stats(stats, stage, &measured) != DRAFTER_OK)
+            continue;
+
+        out << std::left << std::setw(16) << drafter_stage_name(stage) << std::right;
+        out << std::setw(8) << measured.calls;
+        out << std::setw(12) << measured.milliseconds;
+        out << std::setw(14) << measured.allocations;
+        out << std::setw(14) << measured.allocated_bytes / 1024;
+        out << std::setw(12) << measured.elements << "\n";
+    }
+
+    out << std::flush;
 }
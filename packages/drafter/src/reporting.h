@@ -12,6 +12,8 @@
 #include "drafter.h"
 #include "SourceAnnotation.h"
 
+#include <iostream>
+
 /**
  *  \brief Print parser report to stderr.
  *
@@ -26,9 +28,24 @@ void PrintReport(const snowcrash::Report& report, const std::string& source, con
  *
  *  \param report A parser report to print
  *  \param source Source data
+ *  \param size Size of source data in bytes
  *  \param useLineNumbers True if the annotations needs to be printed by line and column number
  *  \param error - code form parsing
+ *  \param out Stream to print into
+ */
+void PrintReport(const drafter_result*,
+    const char* source,
+    const std::size_t size,
+    const bool useLineNumbers,
+    const int error,
+    std::ostream& out = std::cerr);
+
+/**
+ *  \brief Print statistics of each stage of parsing and serialization.
+ *
+ *  \param stats Statistics to print
+ *  \param out Stream to print into
  */
-void PrintReport(const drafter_result*, const std::string& source, const bool useLineNumbers, const int error);
+void PrintStats(const drafter_stats* stats, std::ostream& out);
 
 #endif // #ifndef DRAFTER_REPORTING_H
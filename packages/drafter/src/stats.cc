@@ -0,0 +1,108 @@
+//
+//  stats.cc
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+#include "stats.h"
+
+#include "refract/Element.h"
+#include "refract/Iterate.h"
+
+using namespace drafter;
+
+namespace
+{
+    struct ThreadStats {
+        drafter_stats* stats;
+        std::size_t allocations;
+        std::size_t bytes;
+    };
+
+    // zero-initialized, safe to use from allocation functions at any time
+    thread_local ThreadStats current;
+
+    struct ElementCounter {
+        std::size_t count = 0;
+
+        template <typename T>
+        void operator()(const T&)
+        {
+            ++count;
+        }
+    };
+}
+
+void drafter::CountAllocation(std::size_t size) noexcept
+{
+    ThreadStats& thread = current;
+    ++thread.allocations;
+    thread.bytes += size;
+}
+
+StatsScope::StatsScope(drafter_stats* stats) noexcept : previous_(current.stats), active_(stats != nullptr)
+{
+    if (active_)
+        current.stats = stats;
+}
+
+StatsScope::~StatsScope()
+{
+    if (active_)
+        current.stats = previous_;
+}
+
+StageScope::StageScope(drafter_stage stage, bool start) noexcept
+    : stats_(current.stats ? &current.stats->stages[stage] : nullptr), allocations_(0), bytes_(0), running_(false)
+{
+    if (start)
+        this->start();
+}
+
+StageScope::~StageScope()
+{
+    stop();
+}
+
+void StageScope::start() noexcept
+{
+    if (!stats_ || running_)
+        return;
+
+    running_ = true;
+    allocations_ = current.allocations;
+    bytes_ = current.bytes;
+    start_ = std::chrono::steady_clock::now();
+}
+
+void StageScope::stop() noexcept
+{
+    if (!running_)
+        return;
+
+    const auto end = std::chrono::steady_clock::now();
+
+    running_ = false;
+    ++stats_->calls;
+    stats_->milliseconds += std::chrono::duration<double, std::milli>(end - start_).count();
+    stats_->allocations += current.allocations - allocations_;
+    stats_->allocated_bytes += current.bytes - bytes_;
+}
+
+void StageScope::addElements(std::size_t count) noexcept
+{
+    if (stats_)
+        stats_->elements += count;
+}
+
+void StageScope::addElements(const refract::IElement& element)
+{
+    if (!stats_)
+        return;
+
+    ElementCounter counter;
+    refract::Iterate<> iterate(counter);
+    iterate(element);
+
+    stats_->elements += counter.count;
+}
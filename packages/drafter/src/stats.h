@@ -0,0 +1,88 @@
+//
+//  stats.h
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_STATS_H
+#define DRAFTER_STATS_H
+
+#include "drafter.h"
+
+#include <chrono>
+#include <cstddef>
+
+struct drafter_stats {
+    drafter_stage_stats stages[DRAFTER_STAGE_COUNT];
+};
+
+namespace refract
+{
+    struct IElement;
+}
+
+namespace drafter
+{
+    /** \brief Account a heap allocation to the calling thread, see drafter_count_allocation */
+    void CountAllocation(std::size_t size) noexcept;
+
+    /**
+     *  \brief Collects statistics of the calling thread into given drafter_stats while in scope
+     *
+     *  Does nothing if given NULL, so it can be constructed unconditionally.
+     */
+    class StatsScope
+    {
+        drafter_stats* previous_;
+        bool active_;
+
+    public:
+        explicit StatsScope(drafter_stats* stats) noexcept;
+        ~StatsScope();
+
+        StatsScope(const StatsScope&) = delete;
+        StatsScope& operator=(const StatsScope&) = delete;
+    };
+
+    /**
+     *  \brief Accounts its lifetime to a stage of the statistics being collected
+     *
+     *  Costs a thread local lookup only, unless within a StatsScope collecting statistics.
+     */
+    class StageScope
+    {
+        drafter_stage_stats* stats_;
+        std::chrono::steady_clock::time_point start_;
+        std::size_t allocations_;
+        std::size_t bytes_;
+        bool running_;
+
+    public:
+        explicit StageScope(drafter_stage stage, bool start = true) noexcept;
+        ~StageScope();
+
+        StageScope(const StageScope&) = delete;
+        StageScope& operator=(const StageScope&) = delete;
+
+        /** \return Whether statistics are being collected */
+        bool enabled() const noexcept
+        {
+            return stats_ != nullptr;
+        }
+
+        /** \brief Start measuring, unless already measuring */
+        void start() noexcept;
+
+        /** \brief Stop measuring and account the measurement to the stage */
+        void stop() noexcept;
+
+        /** \brief Account elements to the stage */
+        void addElements(std::size_t count) noexcept;
+
+        /** \brief Account elements of given element (recursively) to the stage */
+        void addElements(const refract::IElement& element);
+    };
+}
+
+#endif
@@ -16,23 +16,6 @@ using namespace drafter;
 using namespace utils;
 using namespace log;
 
-namespace
-{
-    bool enough_severity(severity s)
-    {
-        switch (s) {
-            case debug:
-#ifdef DEBUG
-                return true;
-#else
-                return false;
-#endif
-            default:
-                return true;
-        }
-    }
-} // namespace
-
 trivial_log& trivial_log::instance()
 {
     static trivial_log instance_;
@@ -58,20 +41,18 @@ const char* log::severity_to_str(severity s)
 trivial_entry::trivial_entry(trivial_log& log, severity svrty, size_t line, const char* file)
     : log_(log), severity_(svrty), log_lock_(log_.mtx())
 {
-    if (enough_severity(severity_))
-        if (auto* out = log_.out()) {
-            *out << '[' << severity_to_str(svrty) << "]";
-            *out << '[' << std::this_thread::get_id() << "]";
-            *out << '[' << file << ':' << line << "] ";
-        }
+    if (auto* out = log_.out()) {
+        *out << '[' << severity_to_str(svrty) << "]";
+        *out << '[' << std::this_thread::get_id() << "]";
+        *out << '[' << file << ':' << line << "] ";
+    }
 }
 
 trivial_entry::~trivial_entry()
 {
-    if (enough_severity(severity_))
-        if (auto* out = log_.out()) {
-            *out << '\n'; // TODO @tjanc@ could throw
-        }
+    if (auto* out = log_.out()) {
+        *out << '\n'; // TODO @tjanc@ could throw
+    }
 }
 
 std::mutex& trivial_log::mtx() const
@@ -90,5 +71,6 @@ void trivial_log::enable()
 #ifdef LOGGING
     static std::ofstream log_file_{ "drafter.log" };
     out_ = &log_file_;
+    enabled_.store(true, std::memory_order_release);
 #endif
 }
@@ -9,14 +9,22 @@
 #ifndef DRAFTER_UTILS_LOG_TRIVIAL_H
 #define DRAFTER_UTILS_LOG_TRIVIAL_H
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <ostream>
 
 #define ENABLE_LOGGING (drafter::utils::log::trivial_log::instance().enable())
 
+//
+// Neither the entry is created (and the log locked), nor are the streamed
+// arguments evaluated unless logging is enabled for given severity.
+// Without LOGGING defined the statement is removed at compile time.
+//
 // clang-format off
-#define LOG(svrty) (drafter::utils::log::trivial_entry{ drafter::utils::log::trivial_log::instance(), drafter::utils::log::svrty, __LINE__, __FILE__ })
+#define LOG(svrty) \
+    !drafter::utils::log::is_enabled(drafter::utils::log::svrty) ? (void)0 : \
+    drafter::utils::log::trivial_voidify{} & drafter::utils::log::trivial_entry{ drafter::utils::log::trivial_log::instance(), drafter::utils::log::svrty, __LINE__, __FILE__ }
 // clang-format on
 
 namespace drafter
@@ -58,10 +66,16 @@ namespace drafter
                 ~trivial_entry();
             };
 
+            // turns a streamed entry into `void`, the type of the disabled branch of LOG
+            struct trivial_voidify {
+                void operator&(const trivial_entry&) const noexcept {}
+            };
+
             class trivial_log
             {
                 mutable std::mutex write_mtx_;
                 std::ostream* out_ = nullptr;
+                std::atomic<bool> enabled_{ false };
 
             public:
                 static trivial_log& instance();
@@ -73,8 +87,31 @@ namespace drafter
                 std::mutex& mtx() const;
                 void enable();
                 std::ostream* out();
+
+                bool enabled() const noexcept
+                {
+                    return enabled_.load(std::memory_order_acquire);
+                }
             };
 
+#if defined(LOGGING)
+#if defined(DEBUG)
+            constexpr severity min_severity = debug;
+#else
+            constexpr severity min_severity = info;
+#endif
+
+            inline bool is_enabled(severity svrty) noexcept
+            {
+                return svrty >= min_severity && trivial_log::instance().enabled();
+            }
+#else
+            constexpr bool is_enabled(severity) noexcept
+            {
+                return false;
+            }
+#endif
+
             template <typename T>
             trivial_entry& trivial_entry::operator<<(T&& obj)
             {
@@ -8,14 +8,15 @@
 
 #include "JsonIo.h"
 
-#include <algorithm>
-#include <cstdio>
-#include <cmath>
-#include <iostream>
-#include <iterator>
+#include <cassert>
+#include <cstdint>
+#include <ostream>
 #include <string>
-#include <tuple>
-#include <array>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DRAFTER_JSON_SSE2 1
+#include <emmintrin.h>
+#endif
 
 using namespace drafter;
 using namespace utils;
@@ -23,191 +24,247 @@ using namespace so;
 
 namespace
 {
-    template <typename It>
-    It json_utf_char(It out, unsigned int c)
+    // output is handed over to the stream in chunks of about this size
+    constexpr std::size_t flush_threshold = 16 * 1024;
+
+    const char hex_digits[] = "0123456789abcdef";
+
+    // control characters, quotation mark and reverse solidus
+    inline bool needs_escape(unsigned char c)
+    {
+        return c < 0x20 || c == '"' || c == '\\';
+    }
+
+    ///
+    /// Find the first character in [b, e) that has to be escaped
+    ///
+    const char* find_escaped(const char* b, const char* e)
     {
-        char u_sym_buf[7];
-        std::snprintf(u_sym_buf, 7, "\\u%04x", c);
-        return std::copy( //
-            u_sym_buf,
-            u_sym_buf + 6,
-            out);
+#if defined(DRAFTER_JSON_SSE2)
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i space = _mm_set1_epi8(0x20);
+
+        for (; e - b >= 16; b += 16) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+
+            // unsigned `chunk >= 0x20` as `max(chunk, 0x20) == chunk`
+            const __m128i printable = _mm_cmpeq_epi8(_mm_max_epu8(chunk, space), chunk);
+            const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash));
+
+            if ((_mm_movemask_epi8(special) | (~_mm_movemask_epi8(printable) & 0xFFFF)) != 0)
+                break; // located by the scalar loop below
+        }
+#endif
+        for (; b != e; ++b)
+            if (needs_escape(static_cast<unsigned char>(*b)))
+                return b;
+
+        return e;
     }
 
-    template <typename ItI, typename ItO>
-    ItO escape_json_string(ItI b, ItI e, ItO out)
+    void escape_json_string(std::string& out, const std::string& value)
     {
-        for (; b != e; ++b) {
+        const char* b = value.data();
+        const char* const e = b + value.size();
+
+        while (b != e) {
+            const char* escaped = find_escaped(b, e);
+            out.append(b, escaped);
+
+            if (escaped == e)
+                break;
 
-            char byte = *b;
-            switch (byte) {
+            const char c = *escaped;
+            out += '\\';
+
+            switch (c) {
                 case '\"':
-                    *out = '\\';
-                    ++out;
-                    *out = '"';
-                    ++out;
+                    out += '"';
                     break;
                 case '\\':
-                    *out = '\\';
-                    ++out;
-                    *out = '\\';
-                    ++out;
+                    out += '\\';
                     break;
                 case '\b':
-                    *out = '\\';
-                    ++out;
-                    *out = 'b';
-                    ++out;
+                    out += 'b';
                     break;
                 case '\f':
-                    *out = '\\';
-                    ++out;
-                    *out = 'f';
-                    ++out;
+                    out += 'f';
                     break;
                 case '\n':
-                    *out = '\\';
-                    ++out;
-                    *out = 'n';
-                    ++out;
+                    out += 'n';
                     break;
                 case '\r':
-                    *out = '\\';
-                    ++out;
-                    *out = 'r';
-                    ++out;
+                    out += 'r';
                     break;
                 case '\t':
-                    *out = '\\';
-                    ++out;
-                    *out = 't';
-                    ++out;
+                    out += 't';
                     break;
-                default: {
-                    // unsigned int representation
-                    std::uint8_t c = static_cast<std::uint8_t>(byte);
-                    if (c > 0x1f) { // non-control
-                        *out = byte;
-                        ++out;
-                    } else { // escaped control sequences
-                        out = json_utf_char(out, c);
-                    }
+                default: { // escaped control sequences
+                    const std::uint8_t u = static_cast<std::uint8_t>(c);
+                    const char sequence[] = { 'u', '0', '0', hex_digits[u >> 4], hex_digits[u & 0xF] };
+                    out.append(sequence, sizeof(sequence));
                 }
             }
+
+            b = escaped + 1;
         }
-        return out;
     }
 
-    std::ostream& break_indent(std::ostream& out, int indent)
+    void break_indent(std::string& out, int indent)
     {
-        out << '\n';
-        for (; indent > 0; --indent)
-            out << "  ";
-        return out;
+        out += '\n';
+        out.append(2 * indent, ' ');
     }
 
-    template <bool Packed = true>
-    struct json_printer final {
-        std::ostream& out;
-        const int indent;
+    void write_json_string(std::string& out, const std::string& value)
+    {
+        out += '"';
+        escape_json_string(out, value);
+        out += '"';
+    }
+} // namespace
 
-        void operator()(const Null& value) const
-        {
-            out << "null";
-        }
+JsonWriter::JsonWriter(std::ostream& out) : out_(out), packed_(false) {}
 
-        void operator()(const True& value) const
-        {
-            out << "true";
-        }
+JsonWriter::JsonWriter(std::ostream& out, packed) : out_(out), packed_(true) {}
 
-        void operator()(const False& value) const
-        {
-            out << "false";
-        }
-
-        void operator()(const String& value) const
-        {
-            out << '"';
-            escape_json_string( //
-                value.data.begin(),
-                value.data.end(),
-                std::ostream_iterator<char>(out));
-            out << '"';
-        }
+JsonWriter::~JsonWriter()
+{
+    flush();
+}
 
-        void operator()(const Number& value) const
-        {
-            out << value.data;
-        }
+void JsonWriter::flush()
+{
+    out_.write(buffer_.data(), buffer_.size());
+    buffer_.clear();
+}
 
-        void operator()(const Object& value) const;
-        void operator()(const Array& value) const;
-    };
+void JsonWriter::written()
+{
+    // a complete document is always handed over to the stream
+    if (scopes_.empty() || buffer_.size() >= flush_threshold)
+        flush();
+}
 
-    template <bool Packed>
-    void visit(const Value& obj, std::ostream& out, int indent = 0)
-    {
-        mpark::visit(json_printer<Packed>{ out, indent }, obj);
+void JsonWriter::prefix()
+{
+    if (after_key_) {
+        after_key_ = false;
+        return;
     }
 
-    template <bool Packed>
-    void json_printer<Packed>::operator()(const Object& value) const
-    {
-        out << '{';
-        int commas = value.data.size() - 1;
-        for (const auto& m : value.data) {
-            if (!Packed)
-                break_indent(out, indent + 1);
+    if (scopes_.empty())
+        return;
 
-            out << '"';
-            escape_json_string(m.first.begin(), m.first.end(), std::ostream_iterator<char>(out));
-            out << "\":";
+    scope& current = scopes_.back();
+    assert(!current.is_object);
 
-            if (!Packed)
-                out << ' ';
+    if (!current.empty)
+        buffer_ += ',';
+    if (!packed_)
+        break_indent(buffer_, scopes_.size());
 
-            visit<Packed>(m.second, out, indent + 1);
+    current.empty = false;
+}
 
-            if (commas > 0) {
-                out << ',';
-                --commas;
-            }
-        }
-        if (!(Packed || value.data.empty()))
-            break_indent(out, indent);
-        out << '}';
-    }
+void JsonWriter::begin(bool is_object)
+{
+    prefix();
+    buffer_ += is_object ? '{' : '[';
+    scopes_.push_back(scope{ is_object, true });
+}
 
-    template <bool Packed>
-    void json_printer<Packed>::operator()(const Array& value) const
-    {
-        out << '[';
-        int commas = value.data.size() - 1;
-        for (const auto& m : value.data) {
-            if (!Packed)
-                break_indent(out, indent + 1);
-            visit<Packed>(m, out, indent + 1);
-
-            if (commas > 0) {
-                out << ',';
-                --commas;
-            }
-        }
-        if (!(Packed || value.data.empty()))
-            break_indent(out, indent);
-        out << ']';
-    }
-} // namespace
+void JsonWriter::end()
+{
+    assert(!scopes_.empty());
+    const scope current = scopes_.back();
+    scopes_.pop_back();
+
+    if (!(packed_ || current.empty))
+        break_indent(buffer_, scopes_.size());
+    buffer_ += current.is_object ? '}' : ']';
+    written();
+}
+
+void JsonWriter::begin_object()
+{
+    begin(true);
+}
+
+void JsonWriter::key(const std::string& name)
+{
+    assert(!scopes_.empty() && scopes_.back().is_object);
+    scope& current = scopes_.back();
+
+    if (!current.empty)
+        buffer_ += ',';
+    if (!packed_)
+        break_indent(buffer_, scopes_.size());
+
+    write_json_string(buffer_, name);
+    buffer_ += ':';
+
+    if (!packed_)
+        buffer_ += ' ';
+
+    current.empty = false;
+    after_key_ = true;
+}
+
+void JsonWriter::end_object()
+{
+    end();
+}
+
+void JsonWriter::begin_array()
+{
+    begin(false);
+}
+
+void JsonWriter::end_array()
+{
+    end();
+}
+
+void JsonWriter::null()
+{
+    prefix();
+    buffer_ += "null";
+    written();
+}
+
+void JsonWriter::boolean(bool value)
+{
+    prefix();
+    buffer_ += value ? "true" : "false";
+    written();
+}
+
+void JsonWriter::string(const std::string& value)
+{
+    prefix();
+    write_json_string(buffer_, value);
+    written();
+}
+
+void JsonWriter::number(const std::string& value)
+{
+    prefix();
+    buffer_ += value;
+    written();
+}
 
 std::ostream& so::serialize_json(std::ostream& out, const Value& obj)
 {
-    visit<false>(obj, out);
+    JsonWriter writer(out);
+    write(writer, obj);
     return out;
 }
 
 std::ostream& so::serialize_json(std::ostream& out, const Value& obj, packed)
 {
-    visit<true>(obj, out);
+    JsonWriter writer(out, packed{});
+    write(writer, obj);
     return out;
 }
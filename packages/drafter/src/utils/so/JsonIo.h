@@ -10,6 +10,10 @@
 #define DRAFTER_UTILS_SO_JSONIO_H
 
 #include "Value.h"
+#include "Writer.h"
+
+#include <iosfwd>
+#include <vector>
 
 namespace drafter
 {
@@ -22,6 +26,49 @@ namespace drafter
 
             std::ostream& serialize_json(std::ostream& out, const Value& obj);
             std::ostream& serialize_json(std::ostream& out, const Value& obj, packed);
+
+            ///
+            /// Writer serializing received events as JSON directly into a stream
+            ///
+            /// Output is buffered and handed over to the stream in large chunks;
+            /// a complete document is written out as soon as it is finished.
+            ///
+            class JsonWriter final : public Writer
+            {
+                struct scope {
+                    bool is_object;
+                    bool empty;
+                };
+
+                std::ostream& out_;
+                const bool packed_;
+                std::vector<scope> scopes_;
+                bool after_key_ = false;
+                std::string buffer_;
+
+                void flush();
+                void written();
+                void prefix();
+                void begin(bool is_object);
+                void end();
+
+            public:
+                explicit JsonWriter(std::ostream& out);
+                JsonWriter(std::ostream& out, packed);
+                ~JsonWriter() override;
+
+                void begin_object() override;
+                void key(const std::string& name) override;
+                void end_object() override;
+
+                void begin_array() override;
+                void end_array() override;
+
+                void null() override;
+                void boolean(bool value) override;
+                void string(const std::string& value) override;
+                void number(const std::string& value) override;
+            };
         }
     }
 }
@@ -0,0 +1,139 @@
+//
+//  utils/so/Writer.cc
+//  librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include "Writer.h"
+
+#include <cassert>
+
+using namespace drafter;
+using namespace utils;
+using namespace so;
+
+namespace
+{
+    struct write_visitor final {
+        Writer& out;
+
+        void operator()(const Null&) const
+        {
+            out.null();
+        }
+
+        void operator()(const True&) const
+        {
+            out.boolean(true);
+        }
+
+        void operator()(const False&) const
+        {
+            out.boolean(false);
+        }
+
+        void operator()(const String& value) const
+        {
+            out.string(value.data);
+        }
+
+        void operator()(const Number& value) const
+        {
+            out.number(value.data);
+        }
+
+        void operator()(const Object& value) const
+        {
+            out.begin_object();
+            for (const auto& m : value.data) {
+                out.key(m.first);
+                mpark::visit(*this, m.second);
+            }
+            out.end_object();
+        }
+
+        void operator()(const Array& value) const
+        {
+            out.begin_array();
+            for (const auto& m : value.data)
+                mpark::visit(*this, m);
+            out.end_array();
+        }
+    };
+} // namespace
+
+void so::write(Writer& out, const Value& value)
+{
+    mpark::visit(write_visitor{ out }, value);
+}
+
+Value& ValueWriter::insert(Value&& value)
+{
+    if (stack_.empty()) {
+        result_ = std::move(value);
+        return result_;
+    }
+
+    // containers on the stack are not modified before their last child is closed,
+    // so pointers to them stay valid
+    if (Array* array = mpark::get_if<Array>(stack_.back())) {
+        array->data.emplace_back(std::move(value));
+        return array->data.back();
+    }
+
+    Object* object = mpark::get_if<Object>(stack_.back());
+    assert(object);
+    object->data.emplace_back(std::move(key_), std::move(value));
+    return object->data.back().second;
+}
+
+void ValueWriter::begin_object()
+{
+    stack_.push_back(&insert(Object{}));
+}
+
+void ValueWriter::key(const std::string& name)
+{
+    key_ = name;
+}
+
+void ValueWriter::end_object()
+{
+    assert(!stack_.empty());
+    stack_.pop_back();
+}
+
+void ValueWriter::begin_array()
+{
+    stack_.push_back(&insert(Array{}));
+}
+
+void ValueWriter::end_array()
+{
+    assert(!stack_.empty());
+    stack_.pop_back();
+}
+
+void ValueWriter::null()
+{
+    insert(Null{});
+}
+
+void ValueWriter::boolean(bool value)
+{
+    if (value)
+        insert(True{});
+    else
+        insert(False{});
+}
+
+void ValueWriter::string(const std::string& value)
+{
+    insert(String{ value });
+}
+
+void ValueWriter::number(const std::string& value)
+{
+    insert(Number{ value });
+}
@@ -0,0 +1,83 @@
+//
+//  utils/so/Writer.h
+//  librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_UTILS_SO_WRITER_H
+#define DRAFTER_UTILS_SO_WRITER_H
+
+#include "Value.h"
+
+namespace drafter
+{
+    namespace utils
+    {
+        namespace so
+        {
+            ///
+            /// Event based sink of a Simple Object document
+            ///
+            /// Allows serializing a document without materializing it as
+            /// a Value first. Events must form a well nested document:
+            /// every `begin_*` is matched by an `end_*` and, inside an
+            /// Object, every value is preceded by a `key`.
+            ///
+            class Writer
+            {
+            public:
+                virtual ~Writer() = default;
+
+                virtual void begin_object() = 0;
+                virtual void key(const std::string& name) = 0;
+                virtual void end_object() = 0;
+
+                virtual void begin_array() = 0;
+                virtual void end_array() = 0;
+
+                virtual void null() = 0;
+                virtual void boolean(bool value) = 0;
+                virtual void string(const std::string& value) = 0; // unescaped
+                virtual void number(const std::string& value) = 0;
+            };
+
+            ///
+            /// Emit given Value as a sequence of Writer events
+            ///
+            void write(Writer& out, const Value& value);
+
+            ///
+            /// Writer materializing received events into a Value
+            ///
+            class ValueWriter final : public Writer
+            {
+                Value result_;
+                std::vector<Value*> stack_;
+                std::string key_;
+
+                Value& insert(Value&& value);
+
+            public:
+                void begin_object() override;
+                void key(const std::string& name) override;
+                void end_object() override;
+
+                void begin_array() override;
+                void end_array() override;
+
+                void null() override;
+                void boolean(bool value) override;
+                void string(const std::string& value) override;
+                void number(const std::string& value) override;
+
+                Value& result() noexcept
+                {
+                    return result_;
+                }
+            };
+        } // namespace so
+    }     // namespace utils
+} // namespace drafter
+
+#endif
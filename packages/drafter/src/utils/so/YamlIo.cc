@@ -149,7 +149,7 @@ namespace
         return out;
     }
 
-    std::ostream& serialize_yaml(std::ostream& out, const std::string& obj)
+    std::ostream& serialize_yaml_string(std::ostream& out, const std::string& obj)
     {
         out << '"';
         escape_yaml_string( //
@@ -166,123 +166,132 @@ namespace
             out << "  ";
         return out;
     }
+} // namespace
 
-    struct yaml_printer final {
-        std::ostream& out;
-        const int indent;
-
-        void operator()(const Null& value) const
-        {
-            if (indent > 0)
-                out << ' ';
-
-            out << "null";
-        }
+YamlWriter::YamlWriter(std::ostream& out) : out_(out) {}
 
-        void operator()(const True& value) const
-        {
-            if (indent > 0)
-                out << ' ';
+int YamlWriter::indent() const noexcept
+{
+    return scopes_.empty() ? 0 : scopes_.back().indent + 1;
+}
 
-            out << "true";
-        }
+void YamlWriter::entry()
+{
+    scope& current = scopes_.back();
 
-        void operator()(const False& value) const
-        {
-            if (indent > 0)
-                out << ' ';
+    if (!current.empty || current.indent > 0)
+        out_ << '\n';
 
-            out << "false";
-        }
+    do_indent(out_, current.indent);
+    current.empty = false;
+}
 
-        void operator()(const String& value) const
-        {
-            if (indent > 0)
-                out << ' ';
+void YamlWriter::prefix()
+{
+    if (after_key_) {
+        after_key_ = false;
+        return;
+    }
 
-            serialize_yaml(out, value.data);
-        }
+    if (scopes_.empty())
+        return;
 
-        void operator()(const Number& value) const
-        {
-            if (indent > 0)
-                out << ' ';
+    assert(!scopes_.back().is_object);
 
-            out << value.data;
-        }
+    entry();
+    out_ << '-';
+}
 
-        void operator()(const Object& value) const;
-        void operator()(const Array& value) const;
-    };
+void YamlWriter::begin(bool is_object)
+{
+    prefix();
+    scopes_.push_back(scope{ is_object, true, indent() });
+}
 
-    void visit(const Value& obj, std::ostream& out, int indent = 0)
-    {
-        mpark::visit(yaml_printer{ out, indent }, obj);
+void YamlWriter::end()
+{
+    assert(!scopes_.empty());
+    const scope current = scopes_.back();
+    scopes_.pop_back();
+
+    if (current.empty) {
+        if (current.indent > 0)
+            out_ << ' ';
+        out_ << (current.is_object ? "{}" : "[]");
     }
+}
 
-    void yaml_printer::operator()(const Object& value) const
-    {
-        if (value.data.empty()) {
-            if (indent > 0)
-                out << ' ';
-            out << "{}";
-            return;
-        }
-
-        if (indent > 0)
-            out << '\n';
+void YamlWriter::begin_object()
+{
+    begin(true);
+}
 
-        int newlines = value.data.size() - 1;
-        for (const auto& m : value.data) {
-            do_indent(out, indent);
+void YamlWriter::key(const std::string& name)
+{
+    assert(!scopes_.empty() && scopes_.back().is_object);
 
-            // for clearer, unescaped reading
-            if (is_alphanum_dash(m.first))
-                out << m.first;
-            else
-                serialize_yaml(out, m.first);
+    entry();
 
-            out << ":";
+    // for clearer, unescaped reading
+    if (is_alphanum_dash(name))
+        out_ << name;
+    else
+        serialize_yaml_string(out_, name);
 
-            visit(m.second, out, indent + 1);
+    out_ << ':';
+    after_key_ = true;
+}
 
-            if (newlines > 0) {
-                out << '\n';
-                --newlines;
-            }
-        }
-    }
+void YamlWriter::end_object()
+{
+    end();
+}
 
-    void yaml_printer::operator()(const Array& value) const
-    {
-        if (value.data.empty()) {
-            if (indent > 0)
-                out << ' ';
-            out << "[]";
-            return;
-        }
+void YamlWriter::begin_array()
+{
+    begin(false);
+}
 
-        if (indent > 0)
-            out << '\n';
+void YamlWriter::end_array()
+{
+    end();
+}
 
-        int newlines = value.data.size() - 1;
-        for (const auto& m : value.data) {
-            do_indent(out, indent);
+void YamlWriter::null()
+{
+    prefix();
+    if (indent() > 0)
+        out_ << ' ';
+    out_ << "null";
+}
 
-            out << '-';
+void YamlWriter::boolean(bool value)
+{
+    prefix();
+    if (indent() > 0)
+        out_ << ' ';
+    out_ << (value ? "true" : "false");
+}
 
-            visit(m, out, indent + 1);
+void YamlWriter::string(const std::string& value)
+{
+    prefix();
+    if (indent() > 0)
+        out_ << ' ';
+    serialize_yaml_string(out_, value);
+}
 
-            if (newlines > 0) {
-                out << '\n';
-                --newlines;
-            }
-        }
-    }
-} // namespace
+void YamlWriter::number(const std::string& value)
+{
+    prefix();
+    if (indent() > 0)
+        out_ << ' ';
+    out_ << value;
+}
 
 std::ostream& so::serialize_yaml(std::ostream& out, const Value& obj)
 {
-    visit(obj, out);
+    YamlWriter writer(out);
+    write(writer, obj);
     return out;
 }
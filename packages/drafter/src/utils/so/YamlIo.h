@@ -10,6 +10,10 @@
 #define DRAFTER_UTILS_SO_YAMLIO_H
 
 #include "Value.h"
+#include "Writer.h"
+
+#include <iosfwd>
+#include <vector>
 
 namespace drafter
 {
@@ -18,6 +22,43 @@ namespace drafter
         namespace so
         {
             std::ostream& serialize_yaml(std::ostream& out, const Value& obj);
+
+            ///
+            /// Writer serializing received events as YAML directly into a stream
+            ///
+            class YamlWriter final : public Writer
+            {
+                struct scope {
+                    bool is_object;
+                    bool empty;
+                    int indent;
+                };
+
+                std::ostream& out_;
+                std::vector<scope> scopes_;
+                bool after_key_ = false;
+
+                int indent() const noexcept;
+                void entry();
+                void prefix();
+                void begin(bool is_object);
+                void end();
+
+            public:
+                explicit YamlWriter(std::ostream& out);
+
+                void begin_object() override;
+                void key(const std::string& name) override;
+                void end_object() override;
+
+                void begin_array() override;
+                void end_array() override;
+
+                void null() override;
+                void boolean(bool value) override;
+                void string(const std::string& value) override;
+                void number(const std::string& value) override;
+            };
         }
     }
 }
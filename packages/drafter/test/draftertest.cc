@@ -120,10 +120,13 @@ bool draftertest::handleResultJSON(const std::string& fixturePath, test_options
 
     const auto source = fixture.get(ext::apib);
 
-    int result = snowcrash::parse(source, snowcrash::ExportSourcemapOption, blueprint);
+    mdp::ByteBufferCharacterIndex sourceIndex;
+    mdp::BuildCharacterIndex(sourceIndex, source);
+
+    int result = snowcrash::parse(source, sourceIndex, snowcrash::ExportSourcemapOption, blueprint);
 
     std::ostringstream outStream;
-    drafter::ConversionContext context(source.c_str(), nullptr, testOpts.test(TEST_OPTION_EXPAND_MSON));
+    drafter::ConversionContext context(sourceIndex, nullptr, testOpts.test(TEST_OPTION_EXPAND_MSON));
 
     if (auto parsed = WrapRefract(blueprint, context)) {
         auto soValue = refract::serialize::renderSo(*parsed, testOpts.test(TEST_OPTION_SOURCEMAPS));
@@ -0,0 +1,172 @@
+//
+//  perf-parallel.cc
+//  drafter
+//
+//  Throughput of parsing & serializing a corpus of blueprints
+//  on an increasing number of threads
+//
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "drafter.h"
+
+static const int TestRunCount = 5;
+
+/**
+ *  \brief  Output sink hashing serialized API Elements, so threads can be
+ *          checked for producing the same output without keeping it
+ */
+struct OutputHash {
+    std::size_t hash = 0;
+    std::size_t size = 0;
+
+    static int write(const char* data, size_t size, void* user)
+    {
+        OutputHash* out = static_cast<OutputHash*>(user);
+        out->hash = out->hash * 31 + std::hash<std::string>()(std::string(data, size));
+        out->size += size;
+        return 0;
+    }
+};
+
+static OutputHash ParseAndSerialize(
+    drafter_parse_context* context, const std::string& source, const drafter_serialize_options* options)
+{
+    OutputHash out;
+    drafter_result* result = nullptr;
+
+    drafter_parse_blueprint_with_context(context, source.c_str(), &result, nullptr);
+
+    if (result) {
+        drafter_serialize_to_callback(result, options, OutputHash::write, &out);
+        drafter_free_result(result);
+    }
+
+    return out;
+}
+
+/**
+ *  \brief  Parse the whole corpus @TestRunCount -times on each of @threadCount threads
+ *  \return Wall time spent (ms)
+ */
+static double testfunc(const std::vector<std::string>& sources,
+    const std::vector<OutputHash>& expected,
+    const drafter_serialize_options* options,
+    unsigned threadCount,
+    std::atomic<int>& mismatches)
+{
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            drafter_parse_context* context = drafter_init_parse_context();
+
+            for (int i = 0; i < TestRunCount; ++i) {
+                for (std::size_t f = 0; f < sources.size(); ++f) {
+                    OutputHash out = ParseAndSerialize(context, sources[f], options);
+                    if (out.hash != expected[f].hash || out.size != expected[f].size)
+                        ++mismatches;
+                }
+            }
+
+            drafter_free_parse_context(context);
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, const char* argv[])
+{
+    unsigned maxThreads = std::thread::hardware_concurrency();
+    int firstFile = 1;
+
+    if (argc > 2 && std::strcmp(argv[1], "-j") == 0) {
+        maxThreads = std::atoi(argv[2]);
+        firstFile = 3;
+    }
+
+    if (maxThreads == 0)
+        maxThreads = 1;
+
+    if (argc <= firstFile) {
+        std::cerr << "usage: " << argv[0] << " [-j threads] <blueprint>...\n";
+        exit(EXIT_FAILURE);
+    }
+
+    // Read fixture files
+    std::vector<std::string> sources;
+    std::size_t corpusSize = 0;
+
+    for (int i = firstFile; i < argc; ++i) {
+        std::ifstream inputFileStream(argv[i], std::ios_base::binary);
+        if (!inputFileStream.is_open()) {
+            std::cerr << "fatal: unable to open input file '" << argv[i] << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        std::stringstream inputStream;
+        inputStream << inputFileStream.rdbuf();
+        sources.push_back(inputStream.str());
+        corpusSize += sources.back().size();
+    }
+
+    drafter_serialize_options* options = drafter_init_serialize_options();
+    drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+    drafter_set_sourcemaps_included(options);
+
+    // Reference output from a single thread
+    std::vector<OutputHash> expected;
+    drafter_parse_context* context = drafter_init_parse_context();
+    for (const auto& source : sources)
+        expected.push_back(ParseAndSerialize(context, source, options));
+    drafter_free_parse_context(context);
+
+    std::cout << "running parallel performance test...\n";
+    std::cout << "parsing " << sources.size() << " blueprints (" << corpusSize / 1024 << " KiB) " << TestRunCount
+              << "-times per thread:\n";
+
+    std::atomic<int> mismatches{ 0 };
+    double singleThroughput = 0;
+
+    // powers of two, finishing with exactly maxThreads
+    std::vector<unsigned> threadCounts;
+    for (unsigned threadCount = 1; threadCount < maxThreads; threadCount *= 2)
+        threadCounts.push_back(threadCount);
+    threadCounts.push_back(maxThreads);
+
+    for (unsigned threadCount : threadCounts) {
+        double ms = testfunc(sources, expected, options, threadCount, mismatches);
+
+        double documents = static_cast<double>(sources.size()) * TestRunCount * threadCount;
+        double throughput = documents / (ms / 1000.0);
+
+        if (threadCount == 1)
+            singleThroughput = throughput;
+
+        std::cout << threadCount << " thread(s): " << ms << "ms, " << throughput << " documents/s, "
+                  << (singleThroughput > 0 ? throughput / singleThroughput : 0) << "x\n";
+    }
+
+    drafter_free_serialize_options(options);
+
+    if (mismatches != 0) {
+        std::cerr << "fatal: " << mismatches << " outputs differ from single threaded run\n";
+        exit(EXIT_FAILURE);
+    }
+}
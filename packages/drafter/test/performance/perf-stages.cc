@@ -0,0 +1,392 @@
+//
+//  perf-stages.cc
+//  drafter
+//
+//  Time, throughput, heap allocations and memory of each stage
+//  of the parse pipeline on a corpus of blueprints
+//
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include "snowcrash.h"
+
+#include "BlueprintGenerator.h"
+#include "ConversionContext.h"
+#include "NamedTypesRegistry.h"
+#include "RefractDataStructure.h"
+#include "SerializeKey.h"
+#include "SerializeResult.h"
+#include "options.h"
+
+#include "refract/Element.h"
+#include "refract/FilterVisitor.h"
+#include "refract/Iterate.h"
+#include "refract/JsonSchema.h"
+#include "refract/JsonValue.h"
+#include "refract/Query.h"
+#include "refract/SerializeSo.h"
+#include "refract/TypeQueryVisitor.h"
+
+#include "utils/so/JsonIo.h"
+#include "utils/so/YamlIo.h"
+
+namespace sc = snowcrash;
+namespace so = drafter::utils::so;
+
+static int TestRunCount = 5;
+static drafter_parse_options ParseOptions;
+
+/**
+ *  \brief  Heap usage of the process, maintained by the replaced global
+ *          allocation functions below
+ */
+struct HeapStats {
+    std::size_t allocations;
+    std::size_t bytes;
+    std::size_t live;
+    std::size_t peak;
+};
+
+static HeapStats Heap = { 0, 0, 0, 0 };
+
+// every block is prefixed by its size, so live heap can be tracked on delete
+static const std::size_t BlockHeader = alignof(std::max_align_t);
+
+static void* Allocate(std::size_t size) noexcept
+{
+    void* block = std::malloc(size + BlockHeader);
+    if (!block)
+        return nullptr;
+
+    *static_cast<std::size_t*>(block) = size;
+
+    ++Heap.allocations;
+    Heap.bytes += size;
+    Heap.live += size;
+    Heap.peak = std::max(Heap.peak, Heap.live);
+
+    return static_cast<char*>(block) + BlockHeader;
+}
+
+static void Deallocate(void* ptr) noexcept
+{
+    if (!ptr)
+        return;
+
+    void* block = static_cast<char*>(ptr) - BlockHeader;
+    Heap.live -= *static_cast<std::size_t*>(block);
+    std::free(block);
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* ptr = Allocate(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* ptr = Allocate(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    Deallocate(ptr);
+}
+
+/** \return Peak resident set size of the process (bytes), 0 if unknown */
+static std::size_t PeakRSS()
+{
+#if defined(_WIN32)
+    return 0;
+#else
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage))
+        return 0;
+#if defined(__APPLE__)
+    return usage.ru_maxrss;
+#else
+    return usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+/**
+ *  \brief  Accumulated measurements of one stage of the pipeline
+ */
+struct Stage {
+    const char* name;
+    double ms;
+    std::size_t input;
+    std::size_t allocations;
+    std::size_t bytes;
+    std::size_t peak;
+
+    explicit Stage(const char* name) : name(name), ms(0), input(0), allocations(0), bytes(0), peak(0) {}
+
+    /** \brief  Run @f, accounting it to this stage as processing @size bytes of input */
+    template <typename F>
+    void measure(std::size_t size, F f)
+    {
+        const HeapStats before = Heap;
+        Heap.peak = Heap.live;
+
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto end = std::chrono::steady_clock::now();
+
+        ms += std::chrono::duration<double, std::milli>(end - start).count();
+        input += size;
+        allocations += Heap.allocations - before.allocations;
+        bytes += Heap.bytes - before.bytes;
+        peak = std::max(peak, Heap.peak - before.live);
+
+        Heap.peak = std::max(Heap.peak, before.peak);
+    }
+};
+
+struct Stages {
+    Stage parse{ "parse" };
+    Stage convert{ "convert" };
+    Stage expand{ "expand" };
+    Stage value{ "json-value" };
+    Stage schema{ "json-schema" };
+    Stage render{ "render" };
+    Stage json{ "json" };
+    Stage yaml{ "yaml" };
+
+    std::vector<Stage*> all()
+    {
+        return { &parse, &convert, &expand, &value, &schema, &render, &json, &yaml };
+    }
+};
+
+/**
+ *  \brief  Run the pipeline on @source once, accounting each stage to @stages
+ *
+ *  Conversion to API Elements expands MSON and generates JSON bodies and
+ *  schemas internally; those are run once more on the data structures of
+ *  the result to be measured on their own.
+ */
+static void testfunc(const std::string& source, Stages& stages)
+{
+    const std::size_t size = source.size();
+
+    mdp::ByteBufferCharacterIndex sourceIndex;
+    sc::ParseResult<sc::Blueprint> blueprint;
+
+    stages.parse.measure(size, [&]() {
+        mdp::BuildCharacterIndex(sourceIndex, source);
+        sc::parse(source, sourceIndex, sc::ExportSourcemapOption, blueprint);
+    });
+
+    std::unique_ptr<refract::IElement> result;
+
+    stages.convert.measure(size, [&]() {
+        drafter::ConversionContext context(sourceIndex, &ParseOptions);
+        result = drafter::WrapRefract(blueprint, context);
+    });
+
+    if (blueprint.report.error.code == sc::Error::OK) {
+        refract::FilterVisitor filter(refract::query::Element(drafter::SerializeKey::DataStructure));
+        refract::Iterate<> iterate(filter);
+        iterate(*result);
+
+        drafter::ConversionContext context(sourceIndex);
+        std::vector<std::unique_ptr<refract::IElement> > expanded;
+
+        try {
+            drafter::RegisterNamedTypes(drafter::MakeNodeInfo(blueprint.node.content.elements(),
+                                            blueprint.sourceMap.content.elements()),
+                context);
+
+            stages.expand.measure(size, [&]() {
+                for (const auto* e : filter.elements())
+                    if (auto holder = refract::TypeQueryVisitor::as<const refract::HolderElement>(e))
+                        if (auto data = holder->get().data())
+                            expanded.push_back(drafter::ExpandRefract(data->clone(), context));
+            });
+        } catch (...) {
+            expanded.clear();
+        }
+
+        stages.value.measure(size, [&]() {
+            for (const auto& e : expanded) {
+                std::ostringstream out;
+                so::serialize_json(out, refract::generateJsonValue(*e));
+            }
+        });
+
+        stages.schema.measure(size, [&]() {
+            for (const auto& e : expanded) {
+                std::ostringstream out;
+                so::serialize_json(out, refract::schema::generateJsonSchema(*e));
+            }
+        });
+    }
+
+    so::Value value;
+
+    stages.render.measure(size, [&]() { value = refract::serialize::renderSo(*result, true); });
+
+    stages.json.measure(size, [&]() {
+        std::ostringstream out;
+        so::serialize_json(out, value);
+    });
+
+    stages.yaml.measure(size, [&]() {
+        std::ostringstream out;
+        so::serialize_yaml(out, value);
+    });
+}
+
+static void help()
+{
+    std::cout << "usage: drafter-bench [options] ... <blueprint>..." << std::endl << std::endl;
+    std::cout << "Drafter Pipeline Stages Performance Test Tool" << std::endl << std::endl;
+    std::cout << "options:" << std::endl << std::endl;
+    std::cout << "  -n <runs>               number of measured runs (default " << TestRunCount << ")" << std::endl;
+    std::cout << "  -s, --synthetic <KiB>   add a synthetic blueprint of at least <KiB> KiB" << std::endl;
+    std::cout << "  -t, --types <count>     number of named types of synthetic blueprints" << std::endl;
+    std::cout << "  -j, --threads <count>   threads converting named types, 0 for all (default 1)" << std::endl;
+    std::cout << "  -h, --help              display this help message" << std::endl;
+    exit(0);
+}
+
+int main(int argc, const char* argv[])
+{
+    std::vector<std::string> sources;
+    std::vector<std::size_t> synthetic;
+    drafter::BlueprintShape shape;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0) {
+            help();
+        } else if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            TestRunCount = std::max(1, std::atoi(argv[++i]));
+        } else if ((std::strcmp(argv[i], "-s") == 0 || std::strcmp(argv[i], "--synthetic") == 0) && i + 1 < argc) {
+            synthetic.push_back(std::strtoul(argv[++i], nullptr, 10) * 1024);
+        } else if ((std::strcmp(argv[i], "-t") == 0 || std::strcmp(argv[i], "--types") == 0) && i + 1 < argc) {
+            shape.namedTypes = std::strtoul(argv[++i], nullptr, 10);
+        } else if ((std::strcmp(argv[i], "-j") == 0 || std::strcmp(argv[i], "--threads") == 0) && i + 1 < argc) {
+            drafter_set_conversion_threads(&ParseOptions, std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            std::ifstream inputFileStream(argv[i], std::ios_base::binary);
+            if (!inputFileStream.is_open()) {
+                std::cerr << "fatal: unable to open input file '" << argv[i] << "'\n";
+                exit(EXIT_FAILURE);
+            }
+
+            std::stringstream inputStream;
+            inputStream << inputFileStream.rdbuf();
+            sources.push_back(inputStream.str());
+        }
+    }
+
+    // generated once all options are known, so --types applies regardless of its position
+    for (const auto size : synthetic) {
+        shape.size = size;
+        sources.push_back(drafter::GenerateBlueprint(shape));
+    }
+
+    std::size_t corpusSize = 0;
+    for (const auto& source : sources)
+        corpusSize += source.size();
+
+    if (sources.empty()) {
+        std::cerr << "usage: " << argv[0]
+                  << " [-n runs] [--threads count] [--types count] [--synthetic KiB] <blueprint>...\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::cout << "running pipeline stages performance test...\n";
+    std::cout << "processing " << sources.size() << " blueprints (" << corpusSize / 1024 << " KiB) " << TestRunCount
+              << "-times:\n\n";
+
+    // warm up, e.g. compile regular expressions shared by all runs
+    {
+        Stages warmup;
+        for (const auto& source : sources)
+            testfunc(source, warmup);
+    }
+
+    Stages stages;
+
+    for (int i = 0; i < TestRunCount; ++i)
+        for (const auto& source : sources)
+            testfunc(source, stages);
+
+    const double MiB = 1024.0 * 1024.0;
+
+    std::cout << std::left << std::setw(12) << "stage" << std::right << std::setw(12) << "ms/run" << std::setw(12)
+              << "MiB/s" << std::setw(14) << "allocs/run" << std::setw(14) << "MiB/run" << std::setw(14)
+              << "peak MiB" << "\n";
+
+    std::cout << std::fixed;
+
+    for (const auto* stage : stages.all()) {
+        const double ms = stage->ms / TestRunCount;
+        const double throughput = stage->ms > 0 ? (stage->input / MiB) / (stage->ms / 1000.0) : 0;
+
+        std::cout << std::left << std::setw(12) << stage->name << std::right;
+        std::cout << std::setw(12) << std::setprecision(3) << ms;
+        std::cout << std::setw(12) << std::setprecision(2) << throughput;
+        std::cout << std::setw(14) << stage->allocations / TestRunCount;
+        std::cout << std::setw(14) << stage->bytes / MiB / TestRunCount;
+        std::cout << std::setw(14) << stage->peak / MiB << "\n";
+    }
+
+    std::cout << "\npeak RSS: " << std::setprecision(2) << PeakRSS() / MiB << " MiB\n";
+}
@@ -1021,6 +1021,51 @@ SCENARIO("Extend::merge behaves as expected", "[Element][Extend][merge]")
                     REQUIRE(result);
                 }
 
+                THEN("merged entries replace the first entry of the same key in place")
+                {
+                    auto expected = make_element<ObjectElement>(  //
+                        make_element<RefElement>("Ipsum"),        //
+                        make_element<MemberElement>(              //
+                            "state",                              //
+                            from_primitive("Prague, the capital") //
+                            ),                                    //
+                        make_element<MemberElement>(              //
+                            "foo",                                //
+                            from_primitive(42)                    //
+                            ),                                    //
+                        make_element<MemberElement>(              //
+                            "bar",                                //
+                            from_primitive("quab")                //
+                            ),                                    //
+                        make_element<MemberElement>(              //
+                            "zoo",                                //
+                            make_element<ArrayElement>(           //
+                                from_primitive("lorem"),          //
+                                from_primitive(5))                //
+                            ),                                    //
+                        make_element<RefElement>("Dolorem"),      //
+                        make_element<SelectElement>(              //
+                            make_element<OptionElement>(          //
+                                make_element<MemberElement>(      //
+                                    from_primitive("theist"),     //
+                                    make_empty<StringElement>())  //
+                                ),                                //
+                            make_element<OptionElement>(          //
+                                make_element<MemberElement>(      //
+                                    from_primitive("atheist"),    //
+                                    make_empty<StringElement>())  //
+                                )                                 //
+                            ),                                    //
+                        make_element<MemberElement>(              //
+                            "lorem",                              //
+                            from_primitive("ipsum")               //
+                            )                                     //
+                    );
+
+                    REQUIRE(result);
+                    REQUIRE(*result == *expected);
+                }
+
                 THEN("the result contains two ref elements")
                 {
                     auto ipsum = make_element<RefElement>("Ipsum");
@@ -198,3 +198,141 @@ SCENARIO("InfoElementss can be copied and moved", "[InfoElements]")
         }
     }
 }
+
+SCENARIO("Copies of InfoElements are independent of each other", "[InfoElements]")
+{
+    GIVEN("A InfoElements with two entries and its copy")
+    {
+        InfoElements collection;
+        collection.set("a", make_element<StringElement>("a"));
+        collection.set("b", make_element<StringElement>("b"));
+
+        InfoElements copy(collection);
+
+        THEN("the copy shares the entries of the original")
+        {
+            const InfoElements& constCollection = collection;
+            const InfoElements& constCopy = copy;
+            REQUIRE(constCollection.find("a")->second.get() == constCopy.find("a")->second.get());
+        }
+
+        WHEN("an entry of the copy is replaced")
+        {
+            copy.set("a", make_element<StringElement>("c"));
+
+            THEN("the original keeps its entry")
+            {
+                REQUIRE(*collection.find("a")->second == *make_element<StringElement>("a"));
+                REQUIRE(*copy.find("a")->second == *make_element<StringElement>("c"));
+            }
+        }
+
+        WHEN("an entry of the original is modified through an iterator")
+        {
+            auto it = collection.find("b");
+            it->second = make_element<StringElement>("d");
+
+            THEN("the copy keeps its entry")
+            {
+                REQUIRE(*copy.find("b")->second == *make_element<StringElement>("b"));
+                REQUIRE(*collection.find("b")->second == *make_element<StringElement>("d"));
+            }
+        }
+
+        WHEN("an entry is erased from the original")
+        {
+            collection.erase("a");
+
+            THEN("the copy keeps both entries")
+            {
+                REQUIRE(collection.size() == 1);
+                REQUIRE(copy.size() == 2);
+            }
+        }
+
+        WHEN("the original is cleared")
+        {
+            collection.clear();
+
+            THEN("the copy keeps both entries")
+            {
+                REQUIRE(collection.empty());
+                REQUIRE(copy.size() == 2);
+            }
+        }
+    }
+}
+
+SCENARIO("Entries are claimed from InfoElements shared with copies", "[InfoElements]")
+{
+    GIVEN("An Element with two attributes and its copy sharing them")
+    {
+        auto original = make_element<StringElement>("value");
+        original->attributes().set("a", make_element<StringElement>("a"));
+        original->attributes().set("b", make_element<StringElement>("b"));
+
+        auto copy = clone(*original);
+
+        WHEN("an attribute is claimed from the copy")
+        {
+            auto claimed = copy->attributes().claim("a");
+
+            THEN("the claimed entry is the attribute")
+            {
+                REQUIRE(claimed);
+                REQUIRE(*claimed == *make_element<StringElement>("a"));
+                REQUIRE(copy->attributes().size() == 1);
+            }
+
+            THEN("the original keeps both attributes")
+            {
+                const InfoElements& attributes = original->attributes();
+                REQUIRE(attributes.size() == 2);
+                REQUIRE(attributes.find("a")->second);
+                REQUIRE(*attributes.find("a")->second == *make_element<StringElement>("a"));
+            }
+        }
+    }
+
+    GIVEN("An iterator into an InfoElements copied afterwards")
+    {
+        InfoElements collection;
+        collection.set("a", make_element<StringElement>("a"));
+        collection.set("b", make_element<StringElement>("b"));
+
+        auto it = collection.find("b");
+        InfoElements copy(collection);
+
+        WHEN("the entry of the iterator is claimed")
+        {
+            auto claimed = collection.claim(it);
+
+            THEN("the claimed entry is the one of the iterator")
+            {
+                REQUIRE(claimed);
+                REQUIRE(*claimed == *make_element<StringElement>("b"));
+                REQUIRE(collection.size() == 1);
+            }
+
+            THEN("the copy keeps both entries")
+            {
+                const InfoElements& constCopy = copy;
+                REQUIRE(constCopy.size() == 2);
+                REQUIRE(constCopy.find("b")->second);
+                REQUIRE(*constCopy.find("b")->second == *make_element<StringElement>("b"));
+            }
+        }
+
+        WHEN("the entry of the iterator is erased")
+        {
+            collection.erase(it);
+
+            THEN("the copy keeps both entries")
+            {
+                REQUIRE(collection.size() == 1);
+                REQUIRE(copy.size() == 2);
+                REQUIRE(static_cast<const InfoElements&>(copy).find("b")->second);
+            }
+        }
+    }
+}
@@ -0,0 +1,125 @@
+//
+//  test/refract/dsd/test-SourceMap.cc
+//  test-librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Element.h"
+#include "refract/SerializeSo.h"
+#include "refract/dsd/SourceMap.h"
+#include "utils/so/JsonIo.h"
+
+#include <sstream>
+
+using namespace refract;
+using namespace dsd;
+using namespace drafter::utils;
+
+namespace
+{
+    std::string json(const IElement& e)
+    {
+        std::ostringstream out;
+        so::serialize_json(out, serialize::renderSo(e, true), so::packed{});
+        return out.str();
+    }
+
+    std::unique_ptr<IElement> number(std::size_t value, std::size_t line, std::size_t column)
+    {
+        auto result = make_element<NumberElement>(value);
+        result->attributes().set("line", from_primitive(line));
+        result->attributes().set("column", from_primitive(column));
+        return std::move(result);
+    }
+}
+
+TEST_CASE("`SourceMap`'s default element name is `sourceMap`", "[Element][SourceMap]")
+{
+    REQUIRE(std::string(SourceMap::name) == "sourceMap");
+}
+
+SCENARIO("`SourceMap` is constructed from ranges", "[ElementData][SourceMap]")
+{
+    GIVEN("A default initialized SourceMap")
+    {
+        SourceMap sourceMap;
+
+        THEN("it has neither ranges nor spans")
+        {
+            REQUIRE(sourceMap.ranges().empty());
+            REQUIRE(sourceMap.spans().empty());
+        }
+    }
+
+    GIVEN("A SourceMap constructed from two ranges")
+    {
+        SourceMap sourceMap({ { 3, 4 }, { 10, 2 } });
+
+        THEN("it holds the ranges in order")
+        {
+            REQUIRE(sourceMap.ranges().size() == 2);
+            REQUIRE(sourceMap.ranges()[0].location == 3);
+            REQUIRE(sourceMap.ranges()[0].length == 4);
+            REQUIRE(sourceMap.ranges()[1].location == 10);
+            REQUIRE(sourceMap.ranges()[1].length == 2);
+        }
+
+        THEN("it has no spans")
+        {
+            REQUIRE(sourceMap.spans().empty());
+        }
+
+        THEN("it equals a SourceMap of the same ranges")
+        {
+            REQUIRE(sourceMap == SourceMap({ { 3, 4 }, { 10, 2 } }));
+        }
+
+        THEN("it differs from a SourceMap of other ranges")
+        {
+            REQUIRE(sourceMap != SourceMap({ { 3, 4 } }));
+            REQUIRE(sourceMap != SourceMap({ { 3, 4 }, { 10, 3 } }));
+        }
+
+        THEN("it differs from a SourceMap of the same ranges with spans")
+        {
+            REQUIRE(sourceMap != SourceMap({ { 3, 4 }, { 10, 2 } }, { { 1, 4, 1, 7 }, { 2, 1, 2, 2 } }));
+        }
+    }
+}
+
+SCENARIO("SourceMapElements serialize as nested Arrays of Numbers", "[Element][SourceMap][serialize]")
+{
+    GIVEN("A SourceMapElement of two ranges")
+    {
+        const auto element = make_element<SourceMapElement>(SourceMap({ { 3, 4 }, { 10, 2 } }));
+
+        THEN("it serializes as an Array named sourceMap of location-length Arrays")
+        {
+            auto expected = make_element<ArrayElement>( //
+                make_element<ArrayElement>(from_primitive(3), from_primitive(4)),
+                make_element<ArrayElement>(from_primitive(10), from_primitive(2)));
+            expected->element("sourceMap");
+
+            REQUIRE(json(*element) == json(*expected));
+        }
+    }
+
+    GIVEN("A SourceMapElement of two ranges with spans")
+    {
+        const auto element = make_element<SourceMapElement>(
+            SourceMap({ { 3, 4 }, { 10, 2 } }, { { 1, 4, 1, 7 }, { 2, 1, 2, 2 } }));
+
+        THEN("its Numbers carry line and column attributes")
+        {
+            auto expected = make_element<ArrayElement>( //
+                make_element<ArrayElement>(number(3, 1, 4), number(4, 1, 7)),
+                make_element<ArrayElement>(number(10, 2, 1), number(2, 2, 2)));
+            expected->element("sourceMap");
+
+            REQUIRE(json(*element) == json(*expected));
+        }
+    }
+}
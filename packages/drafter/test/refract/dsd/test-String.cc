@@ -10,6 +10,8 @@
 
 #include "refract/dsd/String.h"
 
+#include <memory>
+
 using namespace refract;
 using namespace dsd;
 
@@ -186,3 +188,67 @@ SCENARIO("string DSDs are tested for equality and inequality", "[Element][String
         }
     }
 }
+
+namespace
+{
+    struct CountingDeferred final : String::Deferred {
+        mutable std::unique_ptr<std::string> value;
+        mutable int computed = 0;
+
+        const std::string& get() const override
+        {
+            if (!value) {
+                value.reset(new std::string("foobar"));
+                ++computed;
+            }
+            return *value;
+        }
+    };
+}
+
+SCENARIO("String is constructed from a deferred value", "[ElementData][String][deferred]")
+{
+    GIVEN("A String constructed from a deferred value")
+    {
+        auto deferred = std::make_shared<CountingDeferred>();
+        String data(deferred);
+
+        THEN("its value is not computed")
+        {
+            REQUIRE(data.deferred());
+            REQUIRE(deferred->computed == 0);
+        }
+
+        WHEN("its value is queried twice")
+        {
+            const std::string& first = data.get();
+            const std::string& second = data.get();
+
+            THEN("the value is computed once")
+            {
+                REQUIRE(first == "foobar");
+                REQUIRE(&first == &second);
+                REQUIRE(deferred->computed == 1);
+            }
+        }
+
+        WHEN("from it another String is copy constructed")
+        {
+            String data2(data);
+
+            THEN("both share the value computed once")
+            {
+                REQUIRE(data2.deferred());
+                REQUIRE(data2.get() == "foobar");
+                REQUIRE(data.get() == "foobar");
+                REQUIRE(deferred->computed == 1);
+            }
+        }
+
+        THEN("it tests positive for equality with a String of the computed value")
+        {
+            REQUIRE(data == String("foobar"));
+            REQUIRE(!data.empty());
+        }
+    }
+}
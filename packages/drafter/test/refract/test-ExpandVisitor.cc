@@ -0,0 +1,86 @@
+//
+//  test/refract/test-ExpandVisitor.cc
+//  test-librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Element.h"
+#include "refract/ExpandVisitor.h"
+#include "refract/Registry.h"
+#include "refract/Utils.h"
+
+using namespace refract;
+
+namespace
+{
+    std::unique_ptr<IElement> namedType(const std::string& name, std::unique_ptr<ObjectElement> type)
+    {
+        type->meta().set("id", from_primitive(name));
+        return std::move(type);
+    }
+
+    std::unique_ptr<IElement> expand(const IElement& e, const Registry& registry, ExpandedTypes* cache)
+    {
+        ExpandVisitor expander(registry, cache);
+        Visit(expander, e);
+        return expander.get();
+    }
+} // namespace
+
+SCENARIO("Named types expanded with a cache expand as without it", "[expand][cache]")
+{
+    GIVEN("a registry with an inheritance chain and a mixin")
+    {
+        Registry registry;
+
+        registry.add(namedType("Base",
+            make_element<ObjectElement>(
+                make_element<MemberElement>("id", make_empty<NumberElement>()))));
+
+        auto derived = make_element<ObjectElement>(make_element<MemberElement>("name", make_empty<StringElement>()));
+        derived->element("Base");
+        registry.add(namedType("Derived", std::move(derived)));
+
+        registry.add(namedType("Mixed", make_element<ObjectElement>(make_element<RefElement>("Derived"))));
+
+        AND_GIVEN("an object referencing all of them")
+        {
+            auto derivedMember = make_empty<ObjectElement>();
+            derivedMember->element("Derived");
+
+            auto element = make_element<ObjectElement>( //
+                make_element<MemberElement>("derived", std::move(derivedMember)),
+                make_element<RefElement>("Mixed"),
+                make_element<RefElement>("Base"));
+
+            const auto expected = expand(*element, registry, nullptr);
+            REQUIRE(expected);
+
+            WHEN("it is expanded repeatedly sharing a cache")
+            {
+                ExpandedTypes cache;
+
+                const auto first = expand(*element, registry, &cache);
+                const auto second = expand(*element, registry, &cache);
+
+                THEN("the expanded types are cached")
+                {
+                    REQUIRE(cache.ancestors.count("Derived") == 1);
+                    REQUIRE(cache.references.count("Mixed") == 1);
+                    REQUIRE(cache.references.count("Base") == 1);
+                }
+
+                THEN("each expansion equals the uncached one")
+                {
+                    REQUIRE(first);
+                    REQUIRE(second);
+                    REQUIRE(*first == *expected);
+                    REQUIRE(*second == *expected);
+                }
+            }
+        }
+    }
+}
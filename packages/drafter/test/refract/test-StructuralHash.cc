@@ -0,0 +1,108 @@
+#include "refract/StructuralHash.h"
+#include "refract/Element.h"
+#include <catch2/catch.hpp>
+
+using namespace refract;
+using namespace refract::dsd;
+
+namespace
+{
+    std::unique_ptr<ObjectElement> makeUser()
+    {
+        auto user = make_element<ObjectElement>(                          //
+            make_element<MemberElement>("name", from_primitive("Jane")), //
+            make_element<MemberElement>("age", from_primitive(42)),      //
+            make_element<MemberElement>("tags", make_element<ArrayElement>(from_primitive("admin"))));
+        user->meta().set("id", from_primitive("User"));
+        return user;
+    }
+}
+
+SCENARIO("Structural equality ignores source maps", "[refract][structuralHash]")
+{
+    GIVEN("Two Elements equal but for their source maps at any depth")
+    {
+        auto lhs = makeUser();
+        auto rhs = makeUser();
+
+        lhs->attributes().set("sourceMap", make_element<SourceMapElement>(SourceMap({ { 3, 4 } })));
+        rhs->get().begin()->get()->attributes().set(
+            "sourceMap", make_element<SourceMapElement>(SourceMap({ { 10, 2 } })));
+
+        THEN("they are structurally equal")
+        {
+            REQUIRE(structurallyEqual(*lhs, *rhs));
+            REQUIRE(structurallyEqual(*rhs, *lhs));
+        }
+
+        THEN("their structural hashes are equal")
+        {
+            REQUIRE(structuralHash(*lhs) == structuralHash(*rhs));
+        }
+    }
+}
+
+SCENARIO("Structural equality compares everything else", "[refract][structuralHash]")
+{
+    GIVEN("An Element")
+    {
+        const auto tested = makeUser();
+
+        THEN("it equals its clone")
+        {
+            const auto copy = clone(*tested);
+            REQUIRE(structurallyEqual(*tested, *copy));
+            REQUIRE(structuralHash(*tested) == structuralHash(*copy));
+        }
+
+        THEN("it differs from one of another nested value")
+        {
+            auto other = makeUser();
+            other->get().push_back(make_element<MemberElement>("extra", from_primitive(true)));
+            REQUIRE(!structurallyEqual(*tested, *other));
+        }
+
+        THEN("it differs from one of other meta")
+        {
+            auto other = makeUser();
+            other->meta().set("id", from_primitive("Admin"));
+            REQUIRE(!structurallyEqual(*tested, *other));
+        }
+
+        THEN("it differs from one of other attributes")
+        {
+            auto other = makeUser();
+            other->attributes().set("typeAttributes", make_element<ArrayElement>(from_primitive("fixed")));
+            REQUIRE(!structurallyEqual(*tested, *other));
+        }
+
+        THEN("it differs from one of another element name")
+        {
+            auto other = makeUser();
+            other->element("User");
+            REQUIRE(!structurallyEqual(*tested, *other));
+        }
+    }
+
+    GIVEN("Elements of equal values of different types")
+    {
+        const auto string = from_primitive("42");
+        const auto number = make_element<NumberElement>(Number{ "42" });
+
+        THEN("they differ")
+        {
+            REQUIRE(!structurallyEqual(*string, *number));
+        }
+    }
+
+    GIVEN("An empty and a non-empty Element")
+    {
+        const auto empty = make_empty<StringElement>();
+        const auto full = from_primitive("");
+
+        THEN("they differ")
+        {
+            REQUIRE(!structurallyEqual(*empty, *full));
+        }
+    }
+}
@@ -0,0 +1,104 @@
+//
+//  test/refract/test-Symbol.cc
+//  test-librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Symbol.h"
+#include "refract/Element.h"
+
+using namespace refract;
+
+SCENARIO("Symbols of the vocabulary are interned", "[symbol]")
+{
+    GIVEN("two Symbols of the same vocabulary name")
+    {
+        const Symbol first{ "sourceMap" };
+        const Symbol second{ std::string("sourceMap") };
+
+        THEN("they are interned")
+        {
+            REQUIRE(first.interned());
+            REQUIRE(second.interned());
+        }
+
+        THEN("they refer to the same string")
+        {
+            REQUIRE(&first.str() == &second.str());
+            REQUIRE(&first.str() == &symbols::sourceMap.str());
+        }
+
+        THEN("they are equal")
+        {
+            REQUIRE(first == second);
+            REQUIRE(first == "sourceMap");
+            REQUIRE(std::string("sourceMap") == first);
+        }
+    }
+
+    GIVEN("the default Symbol")
+    {
+        const Symbol symbol;
+
+        THEN("it is empty and interned")
+        {
+            REQUIRE(symbol.empty());
+            REQUIRE(symbol.interned());
+        }
+    }
+}
+
+SCENARIO("Symbols outside the vocabulary compare by value", "[symbol]")
+{
+    GIVEN("two Symbols of the same named type")
+    {
+        const Symbol first{ "Pagination" };
+        const Symbol second{ "Pagination" };
+
+        THEN("they are not interned")
+        {
+            REQUIRE(!first.interned());
+            REQUIRE(!second.interned());
+        }
+
+        THEN("they are equal")
+        {
+            REQUIRE(first == second);
+            REQUIRE(first == "Pagination");
+        }
+
+        THEN("they differ from other Symbols")
+        {
+            REQUIRE(first != Symbol{ "Error" });
+            REQUIRE(first != Symbol{ "object" });
+        }
+    }
+}
+
+SCENARIO("Element names are Symbols", "[symbol][Element]")
+{
+    GIVEN("a default StringElement")
+    {
+        auto element = make_empty<StringElement>();
+
+        THEN("its name is the interned name of its DSD")
+        {
+            REQUIRE(element->element() == "string");
+            REQUIRE(element->element().interned());
+        }
+
+        WHEN("it is renamed to a named type and cloned")
+        {
+            element->element("Name");
+            auto cloned = clone(*element);
+
+            THEN("the clone shares its name")
+            {
+                REQUIRE(&cloned->element().str() == &element->element().str());
+            }
+        }
+    }
+}
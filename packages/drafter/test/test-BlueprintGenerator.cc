@@ -0,0 +1,122 @@
+//
+//  test-BlueprintGenerator.cc
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "BlueprintGenerator.h"
+#include "drafter.h"
+
+#include <sstream>
+#include <string>
+
+using namespace drafter;
+
+namespace
+{
+    /** \return Whether @source parses without any annotation */
+    bool isClean(const std::string& source)
+    {
+        drafter_result* annotations = nullptr;
+        const drafter_error error = drafter_check_blueprint(source.c_str(), &annotations, nullptr);
+
+        const bool clean = error == DRAFTER_OK && !annotations;
+
+        if (annotations)
+            drafter_free_result(annotations);
+
+        return clean;
+    }
+}
+
+SCENARIO("Synthetic blueprints are deterministic", "[BlueprintGenerator]")
+{
+    GIVEN("A shape")
+    {
+        BlueprintShape shape;
+
+        THEN("equal shapes generate equal blueprints")
+        {
+            REQUIRE(GenerateBlueprint(shape) == GenerateBlueprint(shape));
+        }
+
+        THEN("another seed generates another blueprint")
+        {
+            BlueprintShape other = shape;
+            other.seed = shape.seed + 1;
+
+            REQUIRE(GenerateBlueprint(shape) != GenerateBlueprint(other));
+        }
+
+        THEN("the number of bytes written is the size of the blueprint")
+        {
+            std::ostringstream out;
+            REQUIRE(GenerateBlueprint(out, shape) == out.str().size());
+            REQUIRE(out.str() == GenerateBlueprint(shape));
+        }
+    }
+
+    GIVEN("A shape of given size")
+    {
+        BlueprintShape shape;
+        shape.size = 256 * 1024;
+
+        THEN("the blueprint is at least that large")
+        {
+            REQUIRE(GenerateBlueprint(shape).size() >= shape.size);
+        }
+    }
+}
+
+SCENARIO("Synthetic blueprints parse without annotations", "[BlueprintGenerator]")
+{
+    GIVEN("The default shape")
+    {
+        BlueprintShape shape;
+
+        THEN("the blueprint is valid")
+        {
+            REQUIRE(isClean(GenerateBlueprint(shape)));
+        }
+    }
+
+    GIVEN("A shape of all actions, deep inheritance and wide One Of")
+    {
+        BlueprintShape shape;
+        shape.actions = 5;
+        shape.inheritanceDepth = 8;
+        shape.oneOfFanOut = 6;
+        shape.mixins = 3;
+
+        THEN("the blueprint is valid")
+        {
+            REQUIRE(isClean(GenerateBlueprint(shape)));
+        }
+    }
+
+    GIVEN("A shape of thousands of named types")
+    {
+        BlueprintShape shape;
+        shape.namedTypes = 5000;
+        shape.resourceGroups = 1;
+
+        THEN("the blueprint is valid")
+        {
+            REQUIRE(isClean(GenerateBlueprint(shape)));
+        }
+    }
+
+    GIVEN("A shape without named types")
+    {
+        BlueprintShape shape;
+        shape.namedTypes = 0;
+
+        THEN("the blueprint is valid")
+        {
+            REQUIRE(isClean(GenerateBlueprint(shape)));
+        }
+    }
+}
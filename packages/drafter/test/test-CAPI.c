@@ -210,6 +210,245 @@ int test_parse_to_string_skip_body_schema_gen()
     free(result);
 }
 
+typedef struct {
+    char* data;
+    size_t size;
+    size_t calls;
+    size_t limit;
+} test_sink;
+
+int test_sink_write(const char* data, size_t size, void* user)
+{
+    test_sink* sink = (test_sink*)user;
+
+    if (sink->limit && sink->calls == sink->limit)
+        return 1;
+
+    sink->data = (char*)realloc(sink->data, sink->size + size + 1);
+    memcpy(sink->data + sink->size, data, size);
+    sink->size += size;
+    sink->data[sink->size] = '\0';
+    ++sink->calls;
+
+    return 0;
+}
+
+int test_serialize_to_callback()
+{
+    drafter_result* result = NULL;
+    test_sink sink = { NULL, 0, 0, 0 };
+
+    REQUIRE(drafter_parse_blueprint(source, &result, NULL) == 0);
+    REQUIRE(result);
+
+    drafter_serialize_options* options = drafter_init_serialize_options();
+    drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+
+    char* out = drafter_serialize(result, options);
+    REQUIRE(out);
+
+    REQUIRE(drafter_serialize_to_callback(result, options, test_sink_write, &sink) == DRAFTER_OK);
+    REQUIRE(sink.data);
+    REQUIRE(sink.size == strlen(out));
+    REQUIRE(strcmp(sink.data, out) == 0);
+
+    REQUIRE(drafter_serialize_to_callback(result, options, NULL, &sink) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(drafter_serialize_to_callback(NULL, options, test_sink_write, &sink) == DRAFTER_EINVALID_INPUT);
+
+    drafter_free_serialize_options(options);
+    drafter_free_result(result);
+    free(sink.data);
+    free(out);
+
+    return 0;
+}
+
+int test_serialize_to_callback_abort()
+{
+    drafter_result* result = NULL;
+    test_sink sink = { NULL, 0, 0, 1 };
+    size_t i;
+
+    /* make output span multiple chunks */
+    char large[32768] = "# My API\n\n";
+    for (i = strlen(large); i < sizeof(large) - 2; ++i)
+        large[i] = (i % 64) ? 'x' : '\n';
+    large[i] = '\0';
+
+    REQUIRE(drafter_parse_blueprint(large, &result, NULL) >= 0);
+    REQUIRE(result);
+
+    REQUIRE(drafter_serialize_to_callback(result, NULL, test_sink_write, &sink) == DRAFTER_EINVALID_OUTPUT);
+    REQUIRE(sink.calls == 1);
+
+    drafter_free_result(result);
+    free(sink.data);
+
+    return 0;
+}
+
+int test_parse_buffer()
+{
+    drafter_result* result = NULL;
+    drafter_result* expected_result = NULL;
+
+    /* the buffer is not NUL-terminated */
+    const size_t size = strlen(source);
+    char* buffer = (char*)malloc(size + 8);
+    memcpy(buffer, source, size);
+    memset(buffer + size, 'x', 8);
+
+    REQUIRE(drafter_parse_blueprint(source, &expected_result, NULL) == 0);
+    REQUIRE(drafter_parse_blueprint_buffer(buffer, size, &result, NULL) == 0);
+    REQUIRE(result);
+
+    char* expected_out = drafter_serialize(expected_result, NULL);
+    char* out = drafter_serialize(result, NULL);
+    REQUIRE(strcmp(out, expected_out) == 0);
+    free(out);
+    drafter_free_result(result);
+
+    drafter_parse_context* context = drafter_init_parse_context();
+    REQUIRE(drafter_parse_blueprint_buffer_with_context(context, buffer, size, &result, NULL) == 0);
+    REQUIRE(result);
+
+    out = drafter_serialize(result, NULL);
+    REQUIRE(strcmp(out, expected_out) == 0);
+    free(out);
+    drafter_free_result(result);
+
+    REQUIRE(drafter_parse_blueprint_buffer(NULL, 0, &result, NULL) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(drafter_parse_blueprint_buffer_with_context(NULL, buffer, size, &result, NULL) == DRAFTER_EINVALID_INPUT);
+
+    drafter_free_parse_context(context);
+    drafter_free_result(expected_result);
+    free(expected_out);
+    free(buffer);
+
+    return 0;
+}
+
+int test_stats()
+{
+    drafter_result* result = NULL;
+    drafter_stage_stats stage;
+
+    drafter_stats* stats = drafter_init_stats();
+    REQUIRE(stats);
+
+    drafter_parse_options* pOpts = drafter_init_parse_options();
+    drafter_set_parse_stats(pOpts, stats);
+
+    drafter_serialize_options* sOpts = drafter_init_serialize_options();
+    drafter_set_serialize_stats(sOpts, stats);
+
+    REQUIRE(drafter_parse_blueprint(apib_with_attrs_no_body_nor_schema, &result, pOpts) == 0);
+    REQUIRE(result);
+
+    char* out = drafter_serialize(result, sOpts);
+    REQUIRE(out);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_MARKDOWN, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 1);
+    REQUIRE(stage.elements > 0);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_BLUEPRINT, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 1);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_CONVERSION, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 1);
+    REQUIRE(stage.elements > 0);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_EXPANSION, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls > 0);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_BODY, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 1);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_SCHEMA, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 1);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_SERIALIZATION, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 1);
+    REQUIRE(stage.elements > 0);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_COUNT, &stage) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(drafter_get_stage_stats(NULL, DRAFTER_STAGE_MARKDOWN, &stage) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(strcmp(drafter_stage_name(DRAFTER_STAGE_MARKDOWN), "markdown") == 0);
+    REQUIRE(drafter_stage_name(DRAFTER_STAGE_COUNT) == NULL);
+
+    drafter_reset_stats(stats);
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_CONVERSION, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 0);
+    REQUIRE(stage.elements == 0);
+
+    drafter_free_serialize_options(sOpts);
+    drafter_free_parse_options(pOpts);
+    drafter_free_stats(stats);
+    drafter_free_result(result);
+    free(out);
+
+    return 0;
+}
+
+int test_lazy_body_gen()
+{
+    drafter_result* result = NULL;
+    drafter_stage_stats stage;
+
+    drafter_stats* stats = drafter_init_stats();
+    REQUIRE(stats);
+
+    drafter_parse_options* pOpts = drafter_init_parse_options();
+    drafter_set_lazy_gen_bodies(pOpts);
+    drafter_set_parse_stats(pOpts, stats);
+
+    drafter_serialize_options* sOpts = drafter_init_serialize_options();
+    drafter_set_format(sOpts, DRAFTER_SERIALIZE_JSON);
+    drafter_set_serialize_stats(sOpts, stats);
+
+    REQUIRE(drafter_parse_blueprint(apib_with_attrs_no_body_nor_schema, &result, pOpts) == 0);
+    REQUIRE(result);
+
+    // nothing generated until serialised
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_BODY, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 0);
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_SCHEMA, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 0);
+
+    char* out = drafter_serialize(result, sOpts);
+    REQUIRE(out);
+
+    REQUIRE_INCLUDES("\"messageBody\"", out);
+    REQUIRE_INCLUDES("\"messageBodySchema\"", out);
+
+    // generated once, reused by later serialisations
+    char* again = drafter_serialize(result, sOpts);
+    REQUIRE(again);
+    REQUIRE(strcmp(out, again) == 0);
+
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_BODY, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 1);
+    REQUIRE(drafter_get_stage_stats(stats, DRAFTER_STAGE_SCHEMA, &stage) == DRAFTER_OK);
+    REQUIRE(stage.calls == 1);
+
+    // the same as generated while parsing
+    char* eager = NULL;
+    REQUIRE(drafter_parse_blueprint_to(apib_with_attrs_no_body_nor_schema, &eager, NULL, sOpts) == 0);
+    REQUIRE(eager);
+    REQUIRE(strcmp(out, eager) == 0);
+
+    drafter_free_serialize_options(sOpts);
+    drafter_free_parse_options(pOpts);
+    drafter_free_stats(stats);
+    drafter_free_result(result);
+    free(eager);
+    free(again);
+    free(out);
+
+    return 0;
+}
+
 int main()
 {
     REQUIRE(test_parse_and_serialize() == 0);
@@ -222,6 +461,11 @@ int main()
     REQUIRE(test_blueprint_to_elements_default() == 0);
     test_parse_to_string_skip_body_gen();
     test_parse_to_string_skip_body_schema_gen();
+    REQUIRE(test_serialize_to_callback() == 0);
+    REQUIRE(test_serialize_to_callback_abort() == 0);
+    REQUIRE(test_parse_buffer() == 0);
+    REQUIRE(test_stats() == 0);
+    REQUIRE(test_lazy_body_gen() == 0);
 
     return 0;
 }
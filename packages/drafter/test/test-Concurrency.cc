@@ -0,0 +1,255 @@
+//
+//  test-Concurrency.cc
+//  drafter
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "BlueprintGenerator.h"
+#include "drafter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const char* const fixtures[] = { "api/action-attributes.apib",
+        "api/action-parameters.apib",
+        "api/advanced-action.apib",
+        "api/attributes-named-type-mixin.apib",
+        "api/attributes-references.apib",
+        "api/data-structure.apib",
+        "api/headers.apib",
+        "api/mixin-inheritance.apib",
+        "api/mson.apib",
+        "api/payload-attributes.apib",
+        "api/relation.apib",
+        "api/resource-parameters.apib",
+        "api/schema-body.apib",
+        "api/xml-body.apib" };
+
+    std::string readFixture(const std::string& name)
+    {
+        std::ifstream in(std::string(DRAFTER_TEST_FIXTURES) + name, std::ios_base::binary);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    std::string parseAndSerialize(drafter_parse_context* context,
+        const std::string& source,
+        const drafter_serialize_options* options,
+        const drafter_parse_options* parseOptions = nullptr)
+    {
+        drafter_result* result = nullptr;
+        drafter_parse_blueprint_with_context(context, source.c_str(), &result, parseOptions);
+
+        std::string output;
+
+        if (result) {
+            if (char* serialized = drafter_serialize(result, options)) {
+                output = serialized;
+                free(serialized);
+            }
+
+            drafter_free_result(result);
+        }
+
+        return output;
+    }
+} // namespace
+
+TEST_CASE("Blueprints parsed concurrently serialize as when parsed sequentially", "[drafter][concurrency]")
+{
+    constexpr int threadCount = 4;
+    constexpr int iterations = 3;
+
+    drafter_serialize_options* options = drafter_init_serialize_options();
+    drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+    drafter_set_sourcemaps_included(options);
+
+    std::vector<std::string> sources;
+    std::vector<std::string> expected;
+
+    drafter_parse_context* context = drafter_init_parse_context();
+    for (const char* fixture : fixtures) {
+        sources.push_back(readFixture(fixture));
+        REQUIRE(!sources.back().empty());
+
+        expected.push_back(parseAndSerialize(context, sources.back(), options));
+        REQUIRE(!expected.back().empty());
+    }
+    drafter_free_parse_context(context);
+
+    std::atomic<int> mismatches{ 0 };
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            drafter_parse_context* threadContext = drafter_init_parse_context();
+
+            for (int i = 0; i < iterations; ++i) {
+                // every thread walks the fixtures in a different order
+                for (std::size_t n = 0; n < sources.size(); ++n) {
+                    const std::size_t f = (n + t) % sources.size();
+                    if (parseAndSerialize(threadContext, sources[f], options) != expected[f])
+                        ++mismatches;
+                }
+            }
+
+            drafter_free_parse_context(threadContext);
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    drafter_free_serialize_options(options);
+
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("Named types converted concurrently serialize as when converted sequentially", "[drafter][concurrency]")
+{
+    std::vector<std::string> sources;
+
+    for (const char* fixture : fixtures)
+        sources.push_back(readFixture(fixture));
+
+    // dependency cycles, conversion warnings and errors
+    sources.push_back(readFixture("circular/cross.apib"));
+    sources.push_back(readFixture("circular/mixin-cross.apib"));
+    sources.push_back(readFixture("extend/circular.apib"));
+    sources.push_back(readFixture("mson/primitive-with-members.apib"));
+    sources.push_back(readFixture("mson/resource-unresolved-reference.apib"));
+
+    // named types referred to from within One Of sections only
+    sources.push_back(readFixture("oneof/named-types.apib"));
+
+    drafter::BlueprintShape shape;
+    shape.namedTypes = 256;
+    sources.push_back(drafter::GenerateBlueprint(shape));
+
+    drafter_serialize_options* options = drafter_init_serialize_options();
+    drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+    drafter_set_sourcemaps_included(options);
+
+    drafter_parse_options* concurrent = drafter_init_parse_options();
+    drafter_set_conversion_threads(concurrent, 4);
+
+    drafter_parse_context* context = drafter_init_parse_context();
+
+    for (const auto& source : sources) {
+        REQUIRE(!source.empty());
+
+        const std::string expected = parseAndSerialize(context, source, options);
+        REQUIRE(!expected.empty());
+        REQUIRE(parseAndSerialize(context, source, options, concurrent) == expected);
+    }
+
+    drafter_free_parse_context(context);
+    drafter_free_parse_options(concurrent);
+    drafter_free_serialize_options(options);
+}
+
+TEST_CASE("Nested anonymous types convert concurrently next to types of no name", "[drafter][concurrency]")
+{
+    // `tags` refers to an anonymous `string`, the attributes of `/things` are of no name
+    const std::string source
+        = "# API\n\n"
+          "## /things\n\n"
+          "+ Attributes\n"
+          "    + thing (A)\n\n"
+          "### List [GET]\n\n"
+          "+ Response 200 (application/json)\n\n"
+          "    + Attributes (A)\n\n"
+          "# Data Structures\n\n"
+          "## A (object)\n\n"
+          "+ tags (array[string])\n";
+
+    drafter_serialize_options* options = drafter_init_serialize_options();
+    drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+    drafter_set_sourcemaps_included(options);
+
+    drafter_parse_options* concurrent = drafter_init_parse_options();
+    drafter_set_conversion_threads(concurrent, 4);
+
+    drafter_parse_context* context = drafter_init_parse_context();
+
+    const std::string expected = parseAndSerialize(context, source, options);
+    REQUIRE(!expected.empty());
+    REQUIRE(parseAndSerialize(context, source, options, concurrent) == expected);
+
+    drafter_free_parse_context(context);
+    drafter_free_parse_options(concurrent);
+    drafter_free_serialize_options(options);
+}
+
+TEST_CASE("Lazily generated result serializes concurrently as when generated while parsing", "[drafter][concurrency]")
+{
+    constexpr int threadCount = 8;
+
+    drafter_serialize_options* options = drafter_init_serialize_options();
+    drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+    drafter_set_sourcemaps_included(options);
+
+    drafter_parse_options* lazy = drafter_init_parse_options();
+    drafter_set_lazy_gen_bodies(lazy);
+
+    drafter_parse_context* context = drafter_init_parse_context();
+
+    for (const char* fixture : fixtures) {
+        const std::string source = readFixture(fixture);
+        REQUIRE(!source.empty());
+
+        const std::string expected = parseAndSerialize(context, source, options);
+        REQUIRE(!expected.empty());
+
+        drafter_result* result = nullptr;
+        drafter_parse_blueprint_with_context(context, source.c_str(), &result, lazy);
+        REQUIRE(result);
+
+        std::atomic<int> mismatches{ 0 };
+        std::vector<std::thread> threads;
+
+        // all threads race on generating the bodies and schemas of the result
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&]() {
+                char* serialized = drafter_serialize(result, options);
+                if (!serialized || expected != serialized)
+                    ++mismatches;
+                free(serialized);
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        drafter_free_result(result);
+
+        REQUIRE(mismatches == 0);
+    }
+
+    drafter_free_parse_context(context);
+    drafter_free_parse_options(lazy);
+    drafter_free_serialize_options(options);
+}
+
+TEST_CASE("Parse context rejects invalid input", "[drafter][concurrency]")
+{
+    drafter_parse_context* context = drafter_init_parse_context();
+    drafter_result* result = nullptr;
+
+    REQUIRE(drafter_parse_blueprint_with_context(nullptr, "# API", &result, nullptr) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(drafter_parse_blueprint_with_context(context, nullptr, &result, nullptr) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(result == nullptr);
+
+    drafter_free_parse_context(context);
+}
@@ -1,5 +1,11 @@
 #include "draftertest.h"
 
+#include "drafter.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
 using namespace draftertest;
 
 TEST_REFRACT("api", "description");
@@ -38,3 +44,53 @@ TEST_REFRACT("api", "mixin-inheritance");
 
 TEST_REFRACT("api", "issue-702");
 TEST_REFRACT("api", "issue-741");
+
+namespace
+{
+    std::string parseAndSerialize(const std::string& fixture, const drafter_parse_options* parseOptions)
+    {
+        std::ifstream in(std::string(DRAFTER_TEST_FIXTURES) + fixture, std::ios_base::binary);
+        std::stringstream source;
+        source << in.rdbuf();
+
+        drafter_serialize_options* options = drafter_init_serialize_options();
+        drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+        drafter_set_sourcemaps_included(options);
+
+        drafter_result* result = nullptr;
+        drafter_parse_blueprint(source.str().c_str(), &result, parseOptions);
+
+        std::string output;
+
+        if (result) {
+            if (char* serialized = drafter_serialize(result, options)) {
+                output = serialized;
+                free(serialized);
+            }
+
+            drafter_free_result(result);
+        }
+
+        drafter_free_serialize_options(options);
+
+        return output;
+    }
+}
+
+TEST_CASE("Action attributes generate the same payloads lazily as while parsing", "[refract][api][lazy]")
+{
+    // the first of several payloads of the action is not JSON
+    const char* const fixture = "api/action-attributes-payloads.apib";
+
+    const std::string eager = parseAndSerialize(fixture, nullptr);
+    REQUIRE(!eager.empty());
+    REQUIRE(eager.find("messageBody") != std::string::npos);
+    REQUIRE(eager.find("messageBodySchema") != std::string::npos);
+
+    drafter_parse_options* lazy = drafter_init_parse_options();
+    drafter_set_lazy_gen_bodies(lazy);
+
+    REQUIRE(parseAndSerialize(fixture, lazy) == eager);
+
+    drafter_free_parse_options(lazy);
+}
@@ -277,6 +277,34 @@ SCENARIO("Serialize strings containing control characters", "[simple-object][jso
             }
         }
     }
+
+    GIVEN("long Strings with a single escaped character at every position")
+    {
+        const std::string clean(70, 'x');
+        const std::string escaped[] = { "\"", "\\", "\n", std::string(1, '\0'), "\x1f", "\xc3\xa9" };
+        const std::string replaced[] = { "\\\"", "\\\\", "\\n", "\\u0000", "\\u001f", "\xc3\xa9" };
+
+        WHEN("they are serialized into stringstream as JSON")
+        {
+            THEN("only the escaped character is replaced")
+            {
+                for (std::size_t i = 0; i < sizeof(escaped) / sizeof(escaped[0]); ++i) {
+                    for (std::size_t pos = 0; pos <= clean.size(); ++pos) {
+                        std::string input = clean;
+                        input.insert(pos, escaped[i]);
+
+                        std::string expected = clean;
+                        expected.insert(pos, replaced[i]);
+
+                        std::ostringstream ss;
+                        serialize_json(ss, Value{ String{ input } }, packed{});
+
+                        REQUIRE(ss.str() == '"' + expected + '"');
+                    }
+                }
+            }
+        }
+    }
 }
 
 SCENARIO("Serialize a utils::so::Value into indented and/or packed JSON", "[simple-object][json]")
@@ -0,0 +1,146 @@
+//
+//  test/utils/so/test-Writer.cc
+//  test-librefract
+//
+//  Copyright (c) 2020 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "utils/so/JsonIo.h"
+#include "utils/so/YamlIo.h"
+#include "utils/so/Writer.h"
+
+using namespace drafter;
+using namespace utils;
+using namespace so;
+
+namespace
+{
+    const Value deep_object{ Object{ from_list{},
+        Object::container_type::value_type{ "foo", String{ "Hello world!" } },
+        Object::container_type::value_type{ "empty", Object{} },
+        Object::container_type::value_type{ "bar",
+            Object{ from_list{},
+                Object::container_type::value_type{ "id", Number{ 5 } },
+                Object::container_type::value_type{ "flags", Array{ from_list{}, True{}, False{}, Null{} } },
+                Object::container_type::value_type{ "data",
+                    Array{ from_list{},
+                        String{ "Here comes the sun" },
+                        Array{},
+                        Object{ from_list{}, Object::container_type::value_type{ "type", String{ "blob" } } } } } } } } };
+
+    void write_deep_object(Writer& out)
+    {
+        out.begin_object();
+        out.key("foo");
+        out.string("Hello world!");
+        out.key("empty");
+        out.begin_object();
+        out.end_object();
+        out.key("bar");
+        out.begin_object();
+        out.key("id");
+        out.number("5");
+        out.key("flags");
+        out.begin_array();
+        out.boolean(true);
+        out.boolean(false);
+        out.null();
+        out.end_array();
+        out.key("data");
+        out.begin_array();
+        out.string("Here comes the sun");
+        out.begin_array();
+        out.end_array();
+        out.begin_object();
+        out.key("type");
+        out.string("blob");
+        out.end_object();
+        out.end_array();
+        out.end_object();
+        out.end_object();
+    }
+} // namespace
+
+SCENARIO("Values are reconstructed from Writer events", "[simple-object][writer]")
+{
+    GIVEN("a deep Value")
+    {
+        WHEN("it is written into a ValueWriter")
+        {
+            ValueWriter writer;
+            write(writer, deep_object);
+
+            THEN("the result equals the original Value")
+            {
+                REQUIRE(writer.result() == deep_object);
+            }
+        }
+    }
+
+    GIVEN("a sequence of events describing a deep Value")
+    {
+        WHEN("it is written into a ValueWriter")
+        {
+            ValueWriter writer;
+            write_deep_object(writer);
+
+            THEN("the result equals the described Value")
+            {
+                REQUIRE(writer.result() == deep_object);
+            }
+        }
+    }
+}
+
+SCENARIO("Writer events are serialized as the equivalent Value", "[simple-object][writer]")
+{
+    GIVEN("a sequence of events describing a deep Value")
+    {
+        WHEN("it is written into an indented JsonWriter")
+        {
+            std::ostringstream streamed;
+            JsonWriter writer(streamed);
+            write_deep_object(writer);
+
+            THEN("the output matches the serialized Value")
+            {
+                std::ostringstream expected;
+                serialize_json(expected, deep_object);
+                REQUIRE(streamed.str() == expected.str());
+            }
+        }
+
+        WHEN("it is written into a packed JsonWriter")
+        {
+            std::ostringstream streamed;
+            JsonWriter writer(streamed, packed{});
+            write_deep_object(writer);
+
+            THEN("the output matches the serialized Value")
+            {
+                std::ostringstream expected;
+                serialize_json(expected, deep_object, packed{});
+                REQUIRE(streamed.str() == expected.str());
+            }
+        }
+
+        WHEN("it is written into a YamlWriter")
+        {
+            std::ostringstream streamed;
+            YamlWriter writer(streamed);
+            write_deep_object(writer);
+
+            THEN("the output matches the serialized Value")
+            {
+                std::ostringstream expected;
+                serialize_yaml(expected, deep_object);
+                REQUIRE(streamed.str() == expected.str());
+            }
+        }
+    }
+}